@@ -8,7 +8,8 @@
 #'
 #' You can add a user dictionary to `user_dic`. It should be compiled by
 #' `mecab-dict-index`. You can find an explanation about compiling a user
-#' dictionary in the \url{https://github.com/junhewk/RcppMeCab}.
+#' dictionary in the \url{https://github.com/junhewk/RcppMeCab}. \code{compileUserDic()} compiles
+#' one from a data.frame, and several user dictionaries can be given as a character vector.
 #'
 #' You can also set a system dictionary especially if you are using multiple
 #' dictionaries (for example, using both IPA and Juman dictionary at the same time in Japanese)
@@ -17,12 +18,54 @@
 #'
 #' If you want to get a morpheme only, use `join = FALSE` to put tag names on the attribute.
 #' Basically, the function will return a list of character vectors with (morpheme)/(tag) elements.
+#' `format = "wakati"` returns the morphemes only, without tags in elements or names, and is the fastest
+#' way to segment texts: the feature strings of the morphemes are not read unless a POS filter is given.
+#'
+#' Tokens can be filtered inside C++ with `keep_pos`, `drop_pos`, `stopwords`, `min_len` and `max_len`,
+#' so rejected tokens are never copied into R. POS tags are matched against the first feature field.
+#' With `format = "data.frame"`, `token_id` keeps the numbering of the unfiltered result.
+#'
+#' With `format = "data.frame"`, feature columns are named after the system dictionary
+#' (IPA, UniDic, Juman or mecab-ko-dic). See \code{dictionaryInfo()} for the detected columns.
+#'
+#' With `offset = "byte"` or `offset = "char"`, the data.frame gets `start` and `end` columns locating
+#' each morpheme in the original text, in bytes or in characters, so that
+#' `substr(sentence, start, end)` (or `stringi::stri_sub()`) gives the morpheme back.
+#'
+#' With `expand = TRUE` and mecab-ko-dic, `Inflect`, `Compound` and `Preanalysis` morphemes are replaced
+#' by the component morphemes of their `expression` field (`surface/tag/semantic` joined by `+`) while parsing.
+#' Component rows share `token_id` with the original morpheme and carry it in a `parent_id` column,
+#' which is NA for morphemes that are not expanded. Their `pos`, `first_pos` and `last_pos` are the
+#' component tag and `subtype` its semantic class.
+#'
+#' With `eojeol = TRUE`, the data.frame gets an `eojeol_id` column numbering the whitespace-separated
+#' units of each document, the eojeol of Korean text, so morphemes can be regrouped without aligning
+#' them to the text again. A new unit starts at each morpheme MeCab found whitespace before, and
+#' expanded component rows share the unit of their token. Units of Japanese text are the same
+#' whitespace-separated chunks, not bunsetsu.
+#'
+#' With `server`, or \code{options(mecabServer = socket)}, the sentences are sent to a server started
+#' by \code{mecabServe()}, which parses them with its already loaded dictionary; `sys_dic` and `user_dic`
+#' are then those of the server. `offset`, `expand` and `eojeol` are not available with a server.
+#'
+#' Elements of `sentence` that are already UTF-8 or ASCII are passed to MeCab as they are, and
+#' only other elements are converted in C++. Invalid UTF-8 sequences are replaced by U+FFFD with a
+#' warning naming the documents.
 #'
 #' @param sentence A character vector of any length. For analyzing multiple sentences, put them in one character vector.
 #' @param join A logical to decide the output format. The default value is TRUE. If FALSE, the function will return morphemes only, and tags put in the attribute. if `format="data.frame"`, then this will be ignored.
-#' @param format A data type for the result. The default value is "list". You can set this to "data.frame" to get a result as data frame format.
+#' @param format A data type for the result. The default value is "list". You can set this to "data.frame" to get a result as data frame format, or "wakati" to get morphemes only.
 #' @param sys_dic A location of system MeCab dictionary. The default value is "".
-#' @param user_dic A location of user-specific MeCab dictionary. The default value is "".
+#' @param user_dic A location of user-specific MeCab dictionary, or a character vector of several. The default value is "".
+#' @param keep_pos A character vector of POS tags to keep. Other tokens are dropped during parsing. The default value is NULL (keep all).
+#' @param drop_pos A character vector of POS tags to drop during parsing. The default value is NULL.
+#' @param stopwords A character vector of morphemes to drop during parsing. The default value is NULL.
+#' @param min_len Minimum number of characters of a morpheme to keep. The default value is 0.
+#' @param max_len Maximum number of characters of a morpheme to keep. The default value is Inf.
+#' @param offset Whether to add `start` and `end` columns to `format = "data.frame"`: "none", "byte" or "char". The default value is "none".
+#' @param expand A logical to expand mecab-ko-dic expressions into component rows when `format = "data.frame"`. The default value is FALSE.
+#' @param eojeol A logical to add an `eojeol_id` column when `format = "data.frame"`. The default value is FALSE.
+#' @param server A path of the socket of a \code{mecabServe()} server to delegate to. The default value is `getOption("mecabServer")`, NULL for parsing in this process.
 #' @return A string vector of POS tagged morpheme will be returned in conjoined character
 #'  vector form. Element names of the list are original phrases
 #'
@@ -32,13 +75,20 @@
 #' pos(sentence)
 #' pos(sentence, join = FALSE)
 #' pos(sentence, format = "data.frame")
+#' pos(sentence, format = "data.frame", offset = "char")
+#' pos(sentence, format = "data.frame", eojeol = TRUE)
 #' pos(sentence, user_dic = "~/user_dic.dic")
+#' pos(sentence, stopwords = "texts", min_len = 2)
+#' pos(sentence, server = "/tmp/mecab.sock")
 #' # System dictionary example: in case of using mecab-ipadic-NEologd
 #' pos(sentence, sys_dic = "/usr/local/lib/mecab/dic/mecab-ipadic-neologd/")
 #' }
 #'
 #' @export
-pos <- function(sentence, join = TRUE, format = c("list", "data.frame"), sys_dic = "", user_dic = "") {
+pos <- function(sentence, join = TRUE, format = c("list", "data.frame", "wakati"), sys_dic = "", user_dic = "",
+                keep_pos = NULL, drop_pos = NULL, stopwords = NULL, min_len = 0L, max_len = Inf,
+                offset = c("none", "byte", "char"), expand = FALSE, eojeol = FALSE,
+                server = getOption("mecabServer")) {
   if (typeof(sentence) != "character") {
     if (typeof(sentence) == "factor") {
       stop("The type of input sentence is a factor. Please typesetting it with as.character().")
@@ -49,13 +99,30 @@ pos <- function(sentence, join = TRUE, format = c("list", "data.frame"), sys_dic
 
   if (!isBlank(getOption("mecabSysDic"))) sys_dic <- getOption("mecabSysDic")
 
-  sentence <- purrr::set_names(stringi::stri_enc_toutf8(sentence), names(sentence))
   format <- match.arg(format)
+  offset <- match.arg(offset)
   sys_dic <- paste0(sys_dic, collapse = "")
-  user_dic <- paste0(user_dic, collapse = "")
+  user_dic <- paste0(user_dic, collapse = ",")
+  filter <- tokenFilter(keep_pos, drop_pos, stopwords, min_len, max_len)
+
+  if (!is.null(server)) {
+    if (offset != "none" || isTRUE(expand) || isTRUE(eojeol)) {
+      stop("offset, expand and eojeol are not available with a server.")
+    }
+    request <- if (format == "data.frame") "data.frame" else if (join == TRUE && format == "list") "join" else "list"
+    result <- posServerRcpp(path.expand(server), sentence, request, filter)
+    if (format == "wakati") result <- lapply(result, unname)
+  } else if (format == "wakati") {
+    result <- posWakatiRcpp(sentence, sys_dic, user_dic, filter)
+  } else if (format == "data.frame") {
+    result <- posLoopDFRcpp(sentence, sys_dic, user_dic, filter, offset, isTRUE(expand), isTRUE(eojeol))
+  } else if (join == TRUE) {
+    result <- posApplyJoinRcpp(sentence, sys_dic, user_dic, filter)
+  } else {
+    result <- posApplyRcpp(sentence, sys_dic, user_dic, filter)
+  }
 
   if (format == "data.frame") {
-    result <- posLoopDFRcpp(sentence, sys_dic, user_dic)
     result <- dplyr::mutate(result, dplyr::across(where(is.character), ~ dplyr::na_if(., "*")))
     if (!is.null(names(sentence))) {
       result$doc_id <- factor(
@@ -69,12 +136,6 @@ pos <- function(sentence, join = TRUE, format = c("list", "data.frame"), sys_dic
         levels = seq_along(sentence)
       )
     }
-  } else {
-    if (join == TRUE) {
-      result <- posApplyJoinRcpp(sentence, sys_dic, user_dic)
-    } else {
-      result <- posApplyRcpp(sentence, sys_dic, user_dic)
-    }
   }
 
   return(result)
@@ -24,17 +24,101 @@ namespace RcppMeCab {
         }
     }
 
-    inline List posParallelJoinRcpp(std::vector<std::string> text, std::string sys_dic, std::string user_dic) {
-        typedef SEXP(*Ptr_posParallelJoinRcpp)(SEXP,SEXP,SEXP);
+    inline List dictionaryInfoRcpp(std::string sys_dic, std::string user_dic) {
+        typedef SEXP(*Ptr_dictionaryInfoRcpp)(SEXP,SEXP);
+        static Ptr_dictionaryInfoRcpp p_dictionaryInfoRcpp = NULL;
+        if (p_dictionaryInfoRcpp == NULL) {
+            validateSignature("List(*dictionaryInfoRcpp)(std::string,std::string)");
+            p_dictionaryInfoRcpp = (Ptr_dictionaryInfoRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_dictionaryInfoRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_dictionaryInfoRcpp(Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<List >(rcpp_result_gen);
+    }
+
+    inline List dicSchemaColumnsRcpp(std::string name, int arity) {
+        typedef SEXP(*Ptr_dicSchemaColumnsRcpp)(SEXP,SEXP);
+        static Ptr_dicSchemaColumnsRcpp p_dicSchemaColumnsRcpp = NULL;
+        if (p_dicSchemaColumnsRcpp == NULL) {
+            validateSignature("List(*dicSchemaColumnsRcpp)(std::string,int)");
+            p_dicSchemaColumnsRcpp = (Ptr_dicSchemaColumnsRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_dicSchemaColumnsRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_dicSchemaColumnsRcpp(Shield<SEXP>(Rcpp::wrap(name)), Shield<SEXP>(Rcpp::wrap(arity)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<List >(rcpp_result_gen);
+    }
+
+    inline List compileUserDicRcpp(std::vector<std::string> lines, std::string sys_dic, std::string cache_dir, bool force = false) {
+        typedef SEXP(*Ptr_compileUserDicRcpp)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_compileUserDicRcpp p_compileUserDicRcpp = NULL;
+        if (p_compileUserDicRcpp == NULL) {
+            validateSignature("List(*compileUserDicRcpp)(std::vector<std::string>,std::string,std::string,bool)");
+            p_compileUserDicRcpp = (Ptr_compileUserDicRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_compileUserDicRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_compileUserDicRcpp(Shield<SEXP>(Rcpp::wrap(lines)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(cache_dir)), Shield<SEXP>(Rcpp::wrap(force)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<List >(rcpp_result_gen);
+    }
+
+    inline List packRcpp(IntegerVector doc_id, StringVector token, std::string collapse) {
+        typedef SEXP(*Ptr_packRcpp)(SEXP,SEXP,SEXP);
+        static Ptr_packRcpp p_packRcpp = NULL;
+        if (p_packRcpp == NULL) {
+            validateSignature("List(*packRcpp)(IntegerVector,StringVector,std::string)");
+            p_packRcpp = (Ptr_packRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_packRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_packRcpp(Shield<SEXP>(Rcpp::wrap(doc_id)), Shield<SEXP>(Rcpp::wrap(token)), Shield<SEXP>(Rcpp::wrap(collapse)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<List >(rcpp_result_gen);
+    }
+
+    inline List posParallelJoinRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create(), std::string normalize = "none") {
+        typedef SEXP(*Ptr_posParallelJoinRcpp)(SEXP,SEXP,SEXP,SEXP,SEXP);
         static Ptr_posParallelJoinRcpp p_posParallelJoinRcpp = NULL;
         if (p_posParallelJoinRcpp == NULL) {
-            validateSignature("List(*posParallelJoinRcpp)(std::vector<std::string>,std::string,std::string)");
+            validateSignature("List(*posParallelJoinRcpp)(StringVector,std::string,std::string,List,std::string)");
             p_posParallelJoinRcpp = (Ptr_posParallelJoinRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posParallelJoinRcpp");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_posParallelJoinRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)));
+            rcpp_result_gen = p_posParallelJoinRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)), Shield<SEXP>(Rcpp::wrap(filter)), Shield<SEXP>(Rcpp::wrap(normalize)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -45,17 +129,38 @@ namespace RcppMeCab {
         return Rcpp::as<List >(rcpp_result_gen);
     }
 
-    inline DataFrame posParallelDFRcpp(StringVector text, std::string sys_dic, std::string user_dic) {
-        typedef SEXP(*Ptr_posParallelDFRcpp)(SEXP,SEXP,SEXP);
+    inline DataFrame posParallelDFRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create(), std::string offset = "none", bool expand = false, std::string normalize = "none", bool eojeol = false) {
+        typedef SEXP(*Ptr_posParallelDFRcpp)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
         static Ptr_posParallelDFRcpp p_posParallelDFRcpp = NULL;
         if (p_posParallelDFRcpp == NULL) {
-            validateSignature("DataFrame(*posParallelDFRcpp)(StringVector,std::string,std::string)");
+            validateSignature("DataFrame(*posParallelDFRcpp)(StringVector,std::string,std::string,List,std::string,bool,std::string,bool)");
             p_posParallelDFRcpp = (Ptr_posParallelDFRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posParallelDFRcpp");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_posParallelDFRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)));
+            rcpp_result_gen = p_posParallelDFRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)), Shield<SEXP>(Rcpp::wrap(filter)), Shield<SEXP>(Rcpp::wrap(offset)), Shield<SEXP>(Rcpp::wrap(expand)), Shield<SEXP>(Rcpp::wrap(normalize)), Shield<SEXP>(Rcpp::wrap(eojeol)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<DataFrame >(rcpp_result_gen);
+    }
+
+    inline DataFrame posParallelMultiDFRcpp(StringVector text, std::vector<std::string> sys_dic, std::vector<std::string> user_dic, List filter = List::create(), std::string offset = "none", bool expand = false, std::string normalize = "none") {
+        typedef SEXP(*Ptr_posParallelMultiDFRcpp)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_posParallelMultiDFRcpp p_posParallelMultiDFRcpp = NULL;
+        if (p_posParallelMultiDFRcpp == NULL) {
+            validateSignature("DataFrame(*posParallelMultiDFRcpp)(StringVector,std::vector<std::string>,std::vector<std::string>,List,std::string,bool,std::string)");
+            p_posParallelMultiDFRcpp = (Ptr_posParallelMultiDFRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posParallelMultiDFRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_posParallelMultiDFRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)), Shield<SEXP>(Rcpp::wrap(filter)), Shield<SEXP>(Rcpp::wrap(offset)), Shield<SEXP>(Rcpp::wrap(expand)), Shield<SEXP>(Rcpp::wrap(normalize)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -66,17 +171,164 @@ namespace RcppMeCab {
         return Rcpp::as<DataFrame >(rcpp_result_gen);
     }
 
-    inline List posParallelRcpp(std::vector<std::string> text, std::string sys_dic, std::string user_dic) {
-        typedef SEXP(*Ptr_posParallelRcpp)(SEXP,SEXP,SEXP);
+    inline List posParallelRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create(), std::string normalize = "none") {
+        typedef SEXP(*Ptr_posParallelRcpp)(SEXP,SEXP,SEXP,SEXP,SEXP);
         static Ptr_posParallelRcpp p_posParallelRcpp = NULL;
         if (p_posParallelRcpp == NULL) {
-            validateSignature("List(*posParallelRcpp)(std::vector<std::string>,std::string,std::string)");
+            validateSignature("List(*posParallelRcpp)(StringVector,std::string,std::string,List,std::string)");
             p_posParallelRcpp = (Ptr_posParallelRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posParallelRcpp");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_posParallelRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)));
+            rcpp_result_gen = p_posParallelRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)), Shield<SEXP>(Rcpp::wrap(filter)), Shield<SEXP>(Rcpp::wrap(normalize)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<List >(rcpp_result_gen);
+    }
+
+    inline List posParallelWakatiRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create(), std::string normalize = "none") {
+        typedef SEXP(*Ptr_posParallelWakatiRcpp)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_posParallelWakatiRcpp p_posParallelWakatiRcpp = NULL;
+        if (p_posParallelWakatiRcpp == NULL) {
+            validateSignature("List(*posParallelWakatiRcpp)(StringVector,std::string,std::string,List,std::string)");
+            p_posParallelWakatiRcpp = (Ptr_posParallelWakatiRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posParallelWakatiRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_posParallelWakatiRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)), Shield<SEXP>(Rcpp::wrap(filter)), Shield<SEXP>(Rcpp::wrap(normalize)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<List >(rcpp_result_gen);
+    }
+
+    inline List posParallelFlatRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create(), std::string normalize = "none") {
+        typedef SEXP(*Ptr_posParallelFlatRcpp)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_posParallelFlatRcpp p_posParallelFlatRcpp = NULL;
+        if (p_posParallelFlatRcpp == NULL) {
+            validateSignature("List(*posParallelFlatRcpp)(StringVector,std::string,std::string,List,std::string)");
+            p_posParallelFlatRcpp = (Ptr_posParallelFlatRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posParallelFlatRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_posParallelFlatRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)), Shield<SEXP>(Rcpp::wrap(filter)), Shield<SEXP>(Rcpp::wrap(normalize)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<List >(rcpp_result_gen);
+    }
+
+    inline List posParallelIdsRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, bool tag, std::vector<std::string> types, std::string normalize = "none") {
+        typedef SEXP(*Ptr_posParallelIdsRcpp)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_posParallelIdsRcpp p_posParallelIdsRcpp = NULL;
+        if (p_posParallelIdsRcpp == NULL) {
+            validateSignature("List(*posParallelIdsRcpp)(StringVector,std::string,std::string,List,bool,std::vector<std::string>,std::string)");
+            p_posParallelIdsRcpp = (Ptr_posParallelIdsRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posParallelIdsRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_posParallelIdsRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)), Shield<SEXP>(Rcpp::wrap(filter)), Shield<SEXP>(Rcpp::wrap(tag)), Shield<SEXP>(Rcpp::wrap(types)), Shield<SEXP>(Rcpp::wrap(normalize)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<List >(rcpp_result_gen);
+    }
+
+    inline List posParallelNgramRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, int n_min, int n_max, std::string sep, bool tag, std::string format, std::string normalize = "none") {
+        typedef SEXP(*Ptr_posParallelNgramRcpp)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_posParallelNgramRcpp p_posParallelNgramRcpp = NULL;
+        if (p_posParallelNgramRcpp == NULL) {
+            validateSignature("List(*posParallelNgramRcpp)(StringVector,std::string,std::string,List,int,int,std::string,bool,std::string,std::string)");
+            p_posParallelNgramRcpp = (Ptr_posParallelNgramRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posParallelNgramRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_posParallelNgramRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)), Shield<SEXP>(Rcpp::wrap(filter)), Shield<SEXP>(Rcpp::wrap(n_min)), Shield<SEXP>(Rcpp::wrap(n_max)), Shield<SEXP>(Rcpp::wrap(sep)), Shield<SEXP>(Rcpp::wrap(tag)), Shield<SEXP>(Rcpp::wrap(format)), Shield<SEXP>(Rcpp::wrap(normalize)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<List >(rcpp_result_gen);
+    }
+
+    inline DataFrame posParallelPackRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, std::string collapse, std::string normalize = "none") {
+        typedef SEXP(*Ptr_posParallelPackRcpp)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_posParallelPackRcpp p_posParallelPackRcpp = NULL;
+        if (p_posParallelPackRcpp == NULL) {
+            validateSignature("DataFrame(*posParallelPackRcpp)(StringVector,std::string,std::string,List,std::string,std::string)");
+            p_posParallelPackRcpp = (Ptr_posParallelPackRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posParallelPackRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_posParallelPackRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)), Shield<SEXP>(Rcpp::wrap(filter)), Shield<SEXP>(Rcpp::wrap(collapse)), Shield<SEXP>(Rcpp::wrap(normalize)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<DataFrame >(rcpp_result_gen);
+    }
+
+    inline SEXP posStatsRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create(), std::string normalize = "none") {
+        typedef SEXP(*Ptr_posStatsRcpp)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_posStatsRcpp p_posStatsRcpp = NULL;
+        if (p_posStatsRcpp == NULL) {
+            validateSignature("SEXP(*posStatsRcpp)(StringVector,std::string,std::string,List,std::string)");
+            p_posStatsRcpp = (Ptr_posStatsRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posStatsRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_posStatsRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)), Shield<SEXP>(Rcpp::wrap(filter)), Shield<SEXP>(Rcpp::wrap(normalize)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<SEXP >(rcpp_result_gen);
+    }
+
+    inline List writeTokensRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, std::string file, std::vector<std::string> doc_names, int batch_size) {
+        typedef SEXP(*Ptr_writeTokensRcpp)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_writeTokensRcpp p_writeTokensRcpp = NULL;
+        if (p_writeTokensRcpp == NULL) {
+            validateSignature("List(*writeTokensRcpp)(StringVector,std::string,std::string,List,std::string,std::vector<std::string>,int)");
+            p_writeTokensRcpp = (Ptr_writeTokensRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_writeTokensRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_writeTokensRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)), Shield<SEXP>(Rcpp::wrap(filter)), Shield<SEXP>(Rcpp::wrap(file)), Shield<SEXP>(Rcpp::wrap(doc_names)), Shield<SEXP>(Rcpp::wrap(batch_size)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -87,17 +339,227 @@ namespace RcppMeCab {
         return Rcpp::as<List >(rcpp_result_gen);
     }
 
-    inline List posApplyRcpp(StringVector text, std::string sys_dic, std::string user_dic) {
-        typedef SEXP(*Ptr_posApplyRcpp)(SEXP,SEXP,SEXP);
+    inline SEXP posParallelArrowRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, std::vector<std::string> doc_names, int batch_size, SEXP stream, std::string normalize = "none") {
+        typedef SEXP(*Ptr_posParallelArrowRcpp)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_posParallelArrowRcpp p_posParallelArrowRcpp = NULL;
+        if (p_posParallelArrowRcpp == NULL) {
+            validateSignature("SEXP(*posParallelArrowRcpp)(StringVector,std::string,std::string,List,std::vector<std::string>,int,SEXP,std::string)");
+            p_posParallelArrowRcpp = (Ptr_posParallelArrowRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posParallelArrowRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_posParallelArrowRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)), Shield<SEXP>(Rcpp::wrap(filter)), Shield<SEXP>(Rcpp::wrap(doc_names)), Shield<SEXP>(Rcpp::wrap(batch_size)), Shield<SEXP>(Rcpp::wrap(stream)), Shield<SEXP>(Rcpp::wrap(normalize)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<SEXP >(rcpp_result_gen);
+    }
+
+    inline SEXP mecabServeRcpp(std::string socket, std::string sys_dic, std::string user_dic, int threads) {
+        typedef SEXP(*Ptr_mecabServeRcpp)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_mecabServeRcpp p_mecabServeRcpp = NULL;
+        if (p_mecabServeRcpp == NULL) {
+            validateSignature("SEXP(*mecabServeRcpp)(std::string,std::string,std::string,int)");
+            p_mecabServeRcpp = (Ptr_mecabServeRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_mecabServeRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_mecabServeRcpp(Shield<SEXP>(Rcpp::wrap(socket)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)), Shield<SEXP>(Rcpp::wrap(threads)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<SEXP >(rcpp_result_gen);
+    }
+
+    inline bool mecabServerStopRcpp(std::string socket) {
+        typedef SEXP(*Ptr_mecabServerStopRcpp)(SEXP);
+        static Ptr_mecabServerStopRcpp p_mecabServerStopRcpp = NULL;
+        if (p_mecabServerStopRcpp == NULL) {
+            validateSignature("bool(*mecabServerStopRcpp)(std::string)");
+            p_mecabServerStopRcpp = (Ptr_mecabServerStopRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_mecabServerStopRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_mecabServerStopRcpp(Shield<SEXP>(Rcpp::wrap(socket)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<bool >(rcpp_result_gen);
+    }
+
+    inline StringVector mecabServerSendRcpp(std::string socket, RawVector frame) {
+        typedef SEXP(*Ptr_mecabServerSendRcpp)(SEXP,SEXP);
+        static Ptr_mecabServerSendRcpp p_mecabServerSendRcpp = NULL;
+        if (p_mecabServerSendRcpp == NULL) {
+            validateSignature("StringVector(*mecabServerSendRcpp)(std::string,RawVector)");
+            p_mecabServerSendRcpp = (Ptr_mecabServerSendRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_mecabServerSendRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_mecabServerSendRcpp(Shield<SEXP>(Rcpp::wrap(socket)), Shield<SEXP>(Rcpp::wrap(frame)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<StringVector >(rcpp_result_gen);
+    }
+
+    inline SEXP posServerRcpp(std::string socket, StringVector text, std::string format, List filter = List::create(), std::string normalize = "none") {
+        typedef SEXP(*Ptr_posServerRcpp)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_posServerRcpp p_posServerRcpp = NULL;
+        if (p_posServerRcpp == NULL) {
+            validateSignature("SEXP(*posServerRcpp)(std::string,StringVector,std::string,List,std::string)");
+            p_posServerRcpp = (Ptr_posServerRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posServerRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_posServerRcpp(Shield<SEXP>(Rcpp::wrap(socket)), Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(format)), Shield<SEXP>(Rcpp::wrap(filter)), Shield<SEXP>(Rcpp::wrap(normalize)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<SEXP >(rcpp_result_gen);
+    }
+
+    inline SEXP posAsyncRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, std::string format, std::string offset = "none", bool expand = false, std::string normalize = "none") {
+        typedef SEXP(*Ptr_posAsyncRcpp)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_posAsyncRcpp p_posAsyncRcpp = NULL;
+        if (p_posAsyncRcpp == NULL) {
+            validateSignature("SEXP(*posAsyncRcpp)(StringVector,std::string,std::string,List,std::string,std::string,bool,std::string)");
+            p_posAsyncRcpp = (Ptr_posAsyncRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posAsyncRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_posAsyncRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)), Shield<SEXP>(Rcpp::wrap(filter)), Shield<SEXP>(Rcpp::wrap(format)), Shield<SEXP>(Rcpp::wrap(offset)), Shield<SEXP>(Rcpp::wrap(expand)), Shield<SEXP>(Rcpp::wrap(normalize)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<SEXP >(rcpp_result_gen);
+    }
+
+    inline List posAsyncStatusRcpp(SEXP pointer) {
+        typedef SEXP(*Ptr_posAsyncStatusRcpp)(SEXP);
+        static Ptr_posAsyncStatusRcpp p_posAsyncStatusRcpp = NULL;
+        if (p_posAsyncStatusRcpp == NULL) {
+            validateSignature("List(*posAsyncStatusRcpp)(SEXP)");
+            p_posAsyncStatusRcpp = (Ptr_posAsyncStatusRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posAsyncStatusRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_posAsyncStatusRcpp(Shield<SEXP>(Rcpp::wrap(pointer)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<List >(rcpp_result_gen);
+    }
+
+    inline bool posAsyncCancelRcpp(SEXP pointer) {
+        typedef SEXP(*Ptr_posAsyncCancelRcpp)(SEXP);
+        static Ptr_posAsyncCancelRcpp p_posAsyncCancelRcpp = NULL;
+        if (p_posAsyncCancelRcpp == NULL) {
+            validateSignature("bool(*posAsyncCancelRcpp)(SEXP)");
+            p_posAsyncCancelRcpp = (Ptr_posAsyncCancelRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posAsyncCancelRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_posAsyncCancelRcpp(Shield<SEXP>(Rcpp::wrap(pointer)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<bool >(rcpp_result_gen);
+    }
+
+    inline SEXP posAsyncCollectRcpp(SEXP pointer, StringVector text) {
+        typedef SEXP(*Ptr_posAsyncCollectRcpp)(SEXP,SEXP);
+        static Ptr_posAsyncCollectRcpp p_posAsyncCollectRcpp = NULL;
+        if (p_posAsyncCollectRcpp == NULL) {
+            validateSignature("SEXP(*posAsyncCollectRcpp)(SEXP,StringVector)");
+            p_posAsyncCollectRcpp = (Ptr_posAsyncCollectRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posAsyncCollectRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_posAsyncCollectRcpp(Shield<SEXP>(Rcpp::wrap(pointer)), Shield<SEXP>(Rcpp::wrap(text)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<SEXP >(rcpp_result_gen);
+    }
+
+    inline DataFrame posLatticeRcpp(StringVector text, std::string sys_dic, std::string user_dic, bool marginal = false, std::string normalize = "none") {
+        typedef SEXP(*Ptr_posLatticeRcpp)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_posLatticeRcpp p_posLatticeRcpp = NULL;
+        if (p_posLatticeRcpp == NULL) {
+            validateSignature("DataFrame(*posLatticeRcpp)(StringVector,std::string,std::string,bool,std::string)");
+            p_posLatticeRcpp = (Ptr_posLatticeRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posLatticeRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_posLatticeRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)), Shield<SEXP>(Rcpp::wrap(marginal)), Shield<SEXP>(Rcpp::wrap(normalize)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<DataFrame >(rcpp_result_gen);
+    }
+
+    inline List posApplyRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create()) {
+        typedef SEXP(*Ptr_posApplyRcpp)(SEXP,SEXP,SEXP,SEXP);
         static Ptr_posApplyRcpp p_posApplyRcpp = NULL;
         if (p_posApplyRcpp == NULL) {
-            validateSignature("List(*posApplyRcpp)(StringVector,std::string,std::string)");
+            validateSignature("List(*posApplyRcpp)(StringVector,std::string,std::string,List)");
             p_posApplyRcpp = (Ptr_posApplyRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posApplyRcpp");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_posApplyRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)));
+            rcpp_result_gen = p_posApplyRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)), Shield<SEXP>(Rcpp::wrap(filter)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -108,17 +570,17 @@ namespace RcppMeCab {
         return Rcpp::as<List >(rcpp_result_gen);
     }
 
-    inline List posApplyJoinRcpp(StringVector text, std::string sys_dic, std::string user_dic) {
-        typedef SEXP(*Ptr_posApplyJoinRcpp)(SEXP,SEXP,SEXP);
+    inline List posApplyJoinRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create()) {
+        typedef SEXP(*Ptr_posApplyJoinRcpp)(SEXP,SEXP,SEXP,SEXP);
         static Ptr_posApplyJoinRcpp p_posApplyJoinRcpp = NULL;
         if (p_posApplyJoinRcpp == NULL) {
-            validateSignature("List(*posApplyJoinRcpp)(StringVector,std::string,std::string)");
+            validateSignature("List(*posApplyJoinRcpp)(StringVector,std::string,std::string,List)");
             p_posApplyJoinRcpp = (Ptr_posApplyJoinRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posApplyJoinRcpp");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_posApplyJoinRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)));
+            rcpp_result_gen = p_posApplyJoinRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)), Shield<SEXP>(Rcpp::wrap(filter)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -129,17 +591,38 @@ namespace RcppMeCab {
         return Rcpp::as<List >(rcpp_result_gen);
     }
 
-    inline DataFrame posLoopDFRcpp(StringVector text, std::string sys_dic, std::string user_dic) {
-        typedef SEXP(*Ptr_posLoopDFRcpp)(SEXP,SEXP,SEXP);
+    inline List posWakatiRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create()) {
+        typedef SEXP(*Ptr_posWakatiRcpp)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_posWakatiRcpp p_posWakatiRcpp = NULL;
+        if (p_posWakatiRcpp == NULL) {
+            validateSignature("List(*posWakatiRcpp)(StringVector,std::string,std::string,List)");
+            p_posWakatiRcpp = (Ptr_posWakatiRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posWakatiRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_posWakatiRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)), Shield<SEXP>(Rcpp::wrap(filter)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<List >(rcpp_result_gen);
+    }
+
+    inline DataFrame posLoopDFRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create(), std::string offset = "none", bool expand = false, bool eojeol = false) {
+        typedef SEXP(*Ptr_posLoopDFRcpp)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
         static Ptr_posLoopDFRcpp p_posLoopDFRcpp = NULL;
         if (p_posLoopDFRcpp == NULL) {
-            validateSignature("DataFrame(*posLoopDFRcpp)(StringVector,std::string,std::string)");
+            validateSignature("DataFrame(*posLoopDFRcpp)(StringVector,std::string,std::string,List,std::string,bool,bool)");
             p_posLoopDFRcpp = (Ptr_posLoopDFRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_posLoopDFRcpp");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_posLoopDFRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)));
+            rcpp_result_gen = p_posLoopDFRcpp(Shield<SEXP>(Rcpp::wrap(text)), Shield<SEXP>(Rcpp::wrap(sys_dic)), Shield<SEXP>(Rcpp::wrap(user_dic)), Shield<SEXP>(Rcpp::wrap(filter)), Shield<SEXP>(Rcpp::wrap(offset)), Shield<SEXP>(Rcpp::wrap(expand)), Shield<SEXP>(Rcpp::wrap(eojeol)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -150,6 +633,90 @@ namespace RcppMeCab {
         return Rcpp::as<DataFrame >(rcpp_result_gen);
     }
 
+    inline List tokenStoreOpenRcpp(std::string file) {
+        typedef SEXP(*Ptr_tokenStoreOpenRcpp)(SEXP);
+        static Ptr_tokenStoreOpenRcpp p_tokenStoreOpenRcpp = NULL;
+        if (p_tokenStoreOpenRcpp == NULL) {
+            validateSignature("List(*tokenStoreOpenRcpp)(std::string)");
+            p_tokenStoreOpenRcpp = (Ptr_tokenStoreOpenRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_tokenStoreOpenRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_tokenStoreOpenRcpp(Shield<SEXP>(Rcpp::wrap(file)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<List >(rcpp_result_gen);
+    }
+
+    inline SEXP tokenStoreColumnRcpp(SEXP pointer, std::string column) {
+        typedef SEXP(*Ptr_tokenStoreColumnRcpp)(SEXP,SEXP);
+        static Ptr_tokenStoreColumnRcpp p_tokenStoreColumnRcpp = NULL;
+        if (p_tokenStoreColumnRcpp == NULL) {
+            validateSignature("SEXP(*tokenStoreColumnRcpp)(SEXP,std::string)");
+            p_tokenStoreColumnRcpp = (Ptr_tokenStoreColumnRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_tokenStoreColumnRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_tokenStoreColumnRcpp(Shield<SEXP>(Rcpp::wrap(pointer)), Shield<SEXP>(Rcpp::wrap(column)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<SEXP >(rcpp_result_gen);
+    }
+
+    inline List tokenStoreDocsRcpp(SEXP pointer, std::vector<int> docs, std::vector<int> doc_id) {
+        typedef SEXP(*Ptr_tokenStoreDocsRcpp)(SEXP,SEXP,SEXP);
+        static Ptr_tokenStoreDocsRcpp p_tokenStoreDocsRcpp = NULL;
+        if (p_tokenStoreDocsRcpp == NULL) {
+            validateSignature("List(*tokenStoreDocsRcpp)(SEXP,std::vector<int>,std::vector<int>)");
+            p_tokenStoreDocsRcpp = (Ptr_tokenStoreDocsRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_tokenStoreDocsRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_tokenStoreDocsRcpp(Shield<SEXP>(Rcpp::wrap(pointer)), Shield<SEXP>(Rcpp::wrap(docs)), Shield<SEXP>(Rcpp::wrap(doc_id)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<List >(rcpp_result_gen);
+    }
+
+    inline StringVector contentHashRcpp(StringVector text) {
+        typedef SEXP(*Ptr_contentHashRcpp)(SEXP);
+        static Ptr_contentHashRcpp p_contentHashRcpp = NULL;
+        if (p_contentHashRcpp == NULL) {
+            validateSignature("StringVector(*contentHashRcpp)(StringVector)");
+            p_contentHashRcpp = (Ptr_contentHashRcpp)R_GetCCallable("RcppMeCab", "_RcppMeCab_contentHashRcpp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_contentHashRcpp(Shield<SEXP>(Rcpp::wrap(text)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<StringVector >(rcpp_result_gen);
+    }
+
 }
 
 #endif // RCPP_RcppMeCab_RCPPEXPORTS_H_GEN_
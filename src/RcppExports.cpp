@@ -8,23 +8,168 @@
 
 using namespace Rcpp;
 
+// dictionaryInfoRcpp
+List dictionaryInfoRcpp(std::string sys_dic, std::string user_dic);
+static SEXP _RcppMeCab_dictionaryInfoRcpp_try(SEXP sys_dicSEXP, SEXP user_dicSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
+    Rcpp::traits::input_parameter< std::string >::type user_dic(user_dicSEXP);
+    rcpp_result_gen = Rcpp::wrap(dictionaryInfoRcpp(sys_dic, user_dic));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_dictionaryInfoRcpp(SEXP sys_dicSEXP, SEXP user_dicSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_dictionaryInfoRcpp_try(sys_dicSEXP, user_dicSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dicSchemaColumnsRcpp
+List dicSchemaColumnsRcpp(std::string name, int arity);
+static SEXP _RcppMeCab_dicSchemaColumnsRcpp_try(SEXP nameSEXP, SEXP aritySEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< std::string >::type name(nameSEXP);
+    Rcpp::traits::input_parameter< int >::type arity(aritySEXP);
+    rcpp_result_gen = Rcpp::wrap(dicSchemaColumnsRcpp(name, arity));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_dicSchemaColumnsRcpp(SEXP nameSEXP, SEXP aritySEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_dicSchemaColumnsRcpp_try(nameSEXP, aritySEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// compileUserDicRcpp
+List compileUserDicRcpp(std::vector<std::string> lines, std::string sys_dic, std::string cache_dir, bool force);
+static SEXP _RcppMeCab_compileUserDicRcpp_try(SEXP linesSEXP, SEXP sys_dicSEXP, SEXP cache_dirSEXP, SEXP forceSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< std::vector<std::string> >::type lines(linesSEXP);
+    Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
+    Rcpp::traits::input_parameter< std::string >::type cache_dir(cache_dirSEXP);
+    Rcpp::traits::input_parameter< bool >::type force(forceSEXP);
+    rcpp_result_gen = Rcpp::wrap(compileUserDicRcpp(lines, sys_dic, cache_dir, force));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_compileUserDicRcpp(SEXP linesSEXP, SEXP sys_dicSEXP, SEXP cache_dirSEXP, SEXP forceSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_compileUserDicRcpp_try(linesSEXP, sys_dicSEXP, cache_dirSEXP, forceSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// packRcpp
+List packRcpp(IntegerVector doc_id, StringVector token, std::string collapse);
+static SEXP _RcppMeCab_packRcpp_try(SEXP doc_idSEXP, SEXP tokenSEXP, SEXP collapseSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< IntegerVector >::type doc_id(doc_idSEXP);
+    Rcpp::traits::input_parameter< StringVector >::type token(tokenSEXP);
+    Rcpp::traits::input_parameter< std::string >::type collapse(collapseSEXP);
+    rcpp_result_gen = Rcpp::wrap(packRcpp(doc_id, token, collapse));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_packRcpp(SEXP doc_idSEXP, SEXP tokenSEXP, SEXP collapseSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_packRcpp_try(doc_idSEXP, tokenSEXP, collapseSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
 // posParallelJoinRcpp
-List posParallelJoinRcpp(std::vector<std::string> text, std::string sys_dic, std::string user_dic);
-static SEXP _RcppMeCab_posParallelJoinRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP) {
+List posParallelJoinRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, std::string normalize);
+static SEXP _RcppMeCab_posParallelJoinRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP normalizeSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< std::vector<std::string> >::type text(textSEXP);
+    Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
     Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
     Rcpp::traits::input_parameter< std::string >::type user_dic(user_dicSEXP);
-    rcpp_result_gen = Rcpp::wrap(posParallelJoinRcpp(text, sys_dic, user_dic));
+    Rcpp::traits::input_parameter< List >::type filter(filterSEXP);
+    Rcpp::traits::input_parameter< std::string >::type normalize(normalizeSEXP);
+    rcpp_result_gen = Rcpp::wrap(posParallelJoinRcpp(text, sys_dic, user_dic, filter, normalize));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _RcppMeCab_posParallelJoinRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP) {
+RcppExport SEXP _RcppMeCab_posParallelJoinRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP normalizeSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_RcppMeCab_posParallelJoinRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP));
+        rcpp_result_gen = PROTECT(_RcppMeCab_posParallelJoinRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP, filterSEXP, normalizeSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -45,22 +190,67 @@ RcppExport SEXP _RcppMeCab_posParallelJoinRcpp(SEXP textSEXP, SEXP sys_dicSEXP,
     return rcpp_result_gen;
 }
 // posParallelDFRcpp
-DataFrame posParallelDFRcpp(StringVector text, std::string sys_dic, std::string user_dic);
-static SEXP _RcppMeCab_posParallelDFRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP) {
+DataFrame posParallelDFRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, std::string offset, bool expand, std::string normalize, bool eojeol);
+static SEXP _RcppMeCab_posParallelDFRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP offsetSEXP, SEXP expandSEXP, SEXP normalizeSEXP, SEXP eojeolSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
     Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
     Rcpp::traits::input_parameter< std::string >::type user_dic(user_dicSEXP);
-    rcpp_result_gen = Rcpp::wrap(posParallelDFRcpp(text, sys_dic, user_dic));
+    Rcpp::traits::input_parameter< List >::type filter(filterSEXP);
+    Rcpp::traits::input_parameter< std::string >::type offset(offsetSEXP);
+    Rcpp::traits::input_parameter< bool >::type expand(expandSEXP);
+    Rcpp::traits::input_parameter< std::string >::type normalize(normalizeSEXP);
+    Rcpp::traits::input_parameter< bool >::type eojeol(eojeolSEXP);
+    rcpp_result_gen = Rcpp::wrap(posParallelDFRcpp(text, sys_dic, user_dic, filter, offset, expand, normalize, eojeol));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_posParallelDFRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP offsetSEXP, SEXP expandSEXP, SEXP normalizeSEXP, SEXP eojeolSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_posParallelDFRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP, filterSEXP, offsetSEXP, expandSEXP, normalizeSEXP, eojeolSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// posParallelMultiDFRcpp
+DataFrame posParallelMultiDFRcpp(StringVector text, std::vector<std::string> sys_dic, std::vector<std::string> user_dic, List filter, std::string offset, bool expand, std::string normalize);
+static SEXP _RcppMeCab_posParallelMultiDFRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP offsetSEXP, SEXP expandSEXP, SEXP normalizeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
+    Rcpp::traits::input_parameter< std::vector<std::string> >::type sys_dic(sys_dicSEXP);
+    Rcpp::traits::input_parameter< std::vector<std::string> >::type user_dic(user_dicSEXP);
+    Rcpp::traits::input_parameter< List >::type filter(filterSEXP);
+    Rcpp::traits::input_parameter< std::string >::type offset(offsetSEXP);
+    Rcpp::traits::input_parameter< bool >::type expand(expandSEXP);
+    Rcpp::traits::input_parameter< std::string >::type normalize(normalizeSEXP);
+    rcpp_result_gen = Rcpp::wrap(posParallelMultiDFRcpp(text, sys_dic, user_dic, filter, offset, expand, normalize));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _RcppMeCab_posParallelDFRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP) {
+RcppExport SEXP _RcppMeCab_posParallelMultiDFRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP offsetSEXP, SEXP expandSEXP, SEXP normalizeSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_RcppMeCab_posParallelDFRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP));
+        rcpp_result_gen = PROTECT(_RcppMeCab_posParallelMultiDFRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP, filterSEXP, offsetSEXP, expandSEXP, normalizeSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -81,22 +271,24 @@ RcppExport SEXP _RcppMeCab_posParallelDFRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SE
     return rcpp_result_gen;
 }
 // posParallelRcpp
-List posParallelRcpp(std::vector<std::string> text, std::string sys_dic, std::string user_dic);
-static SEXP _RcppMeCab_posParallelRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP) {
+List posParallelRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, std::string normalize);
+static SEXP _RcppMeCab_posParallelRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP normalizeSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< std::vector<std::string> >::type text(textSEXP);
+    Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
     Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
     Rcpp::traits::input_parameter< std::string >::type user_dic(user_dicSEXP);
-    rcpp_result_gen = Rcpp::wrap(posParallelRcpp(text, sys_dic, user_dic));
+    Rcpp::traits::input_parameter< List >::type filter(filterSEXP);
+    Rcpp::traits::input_parameter< std::string >::type normalize(normalizeSEXP);
+    rcpp_result_gen = Rcpp::wrap(posParallelRcpp(text, sys_dic, user_dic, filter, normalize));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _RcppMeCab_posParallelRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP) {
+RcppExport SEXP _RcppMeCab_posParallelRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP normalizeSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_RcppMeCab_posParallelRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP));
+        rcpp_result_gen = PROTECT(_RcppMeCab_posParallelRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP, filterSEXP, normalizeSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -116,23 +308,25 @@ RcppExport SEXP _RcppMeCab_posParallelRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// posApplyRcpp
-List posApplyRcpp(StringVector text, std::string sys_dic, std::string user_dic);
-static SEXP _RcppMeCab_posApplyRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP) {
+// posParallelWakatiRcpp
+List posParallelWakatiRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, std::string normalize);
+static SEXP _RcppMeCab_posParallelWakatiRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP normalizeSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
     Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
     Rcpp::traits::input_parameter< std::string >::type user_dic(user_dicSEXP);
-    rcpp_result_gen = Rcpp::wrap(posApplyRcpp(text, sys_dic, user_dic));
+    Rcpp::traits::input_parameter< List >::type filter(filterSEXP);
+    Rcpp::traits::input_parameter< std::string >::type normalize(normalizeSEXP);
+    rcpp_result_gen = Rcpp::wrap(posParallelWakatiRcpp(text, sys_dic, user_dic, filter, normalize));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _RcppMeCab_posApplyRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP) {
+RcppExport SEXP _RcppMeCab_posParallelWakatiRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP normalizeSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_RcppMeCab_posApplyRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP));
+        rcpp_result_gen = PROTECT(_RcppMeCab_posParallelWakatiRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP, filterSEXP, normalizeSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -152,23 +346,25 @@ RcppExport SEXP _RcppMeCab_posApplyRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP us
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// posApplyJoinRcpp
-List posApplyJoinRcpp(StringVector text, std::string sys_dic, std::string user_dic);
-static SEXP _RcppMeCab_posApplyJoinRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP) {
+// posParallelFlatRcpp
+List posParallelFlatRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, std::string normalize);
+static SEXP _RcppMeCab_posParallelFlatRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP normalizeSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
     Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
     Rcpp::traits::input_parameter< std::string >::type user_dic(user_dicSEXP);
-    rcpp_result_gen = Rcpp::wrap(posApplyJoinRcpp(text, sys_dic, user_dic));
+    Rcpp::traits::input_parameter< List >::type filter(filterSEXP);
+    Rcpp::traits::input_parameter< std::string >::type normalize(normalizeSEXP);
+    rcpp_result_gen = Rcpp::wrap(posParallelFlatRcpp(text, sys_dic, user_dic, filter, normalize));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _RcppMeCab_posApplyJoinRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP) {
+RcppExport SEXP _RcppMeCab_posParallelFlatRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP normalizeSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_RcppMeCab_posApplyJoinRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP));
+        rcpp_result_gen = PROTECT(_RcppMeCab_posParallelFlatRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP, filterSEXP, normalizeSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -188,23 +384,844 @@ RcppExport SEXP _RcppMeCab_posApplyJoinRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// posLoopDFRcpp
-DataFrame posLoopDFRcpp(StringVector text, std::string sys_dic, std::string user_dic);
-static SEXP _RcppMeCab_posLoopDFRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP) {
+// posParallelIdsRcpp
+List posParallelIdsRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, bool tag, std::vector<std::string> types, std::string normalize);
+static SEXP _RcppMeCab_posParallelIdsRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP tagSEXP, SEXP typesSEXP, SEXP normalizeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
+    Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
+    Rcpp::traits::input_parameter< std::string >::type user_dic(user_dicSEXP);
+    Rcpp::traits::input_parameter< List >::type filter(filterSEXP);
+    Rcpp::traits::input_parameter< bool >::type tag(tagSEXP);
+    Rcpp::traits::input_parameter< std::vector<std::string> >::type types(typesSEXP);
+    Rcpp::traits::input_parameter< std::string >::type normalize(normalizeSEXP);
+    rcpp_result_gen = Rcpp::wrap(posParallelIdsRcpp(text, sys_dic, user_dic, filter, tag, types, normalize));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_posParallelIdsRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP tagSEXP, SEXP typesSEXP, SEXP normalizeSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_posParallelIdsRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP, filterSEXP, tagSEXP, typesSEXP, normalizeSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// posParallelNgramRcpp
+List posParallelNgramRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, int n_min, int n_max, std::string sep, bool tag, std::string format, std::string normalize);
+static SEXP _RcppMeCab_posParallelNgramRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP n_minSEXP, SEXP n_maxSEXP, SEXP sepSEXP, SEXP tagSEXP, SEXP formatSEXP, SEXP normalizeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
+    Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
+    Rcpp::traits::input_parameter< std::string >::type user_dic(user_dicSEXP);
+    Rcpp::traits::input_parameter< List >::type filter(filterSEXP);
+    Rcpp::traits::input_parameter< int >::type n_min(n_minSEXP);
+    Rcpp::traits::input_parameter< int >::type n_max(n_maxSEXP);
+    Rcpp::traits::input_parameter< std::string >::type sep(sepSEXP);
+    Rcpp::traits::input_parameter< bool >::type tag(tagSEXP);
+    Rcpp::traits::input_parameter< std::string >::type format(formatSEXP);
+    Rcpp::traits::input_parameter< std::string >::type normalize(normalizeSEXP);
+    rcpp_result_gen = Rcpp::wrap(posParallelNgramRcpp(text, sys_dic, user_dic, filter, n_min, n_max, sep, tag, format, normalize));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_posParallelNgramRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP n_minSEXP, SEXP n_maxSEXP, SEXP sepSEXP, SEXP tagSEXP, SEXP formatSEXP, SEXP normalizeSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_posParallelNgramRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP, filterSEXP, n_minSEXP, n_maxSEXP, sepSEXP, tagSEXP, formatSEXP, normalizeSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// posParallelPackRcpp
+DataFrame posParallelPackRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, std::string collapse, std::string normalize);
+static SEXP _RcppMeCab_posParallelPackRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP collapseSEXP, SEXP normalizeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
+    Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
+    Rcpp::traits::input_parameter< std::string >::type user_dic(user_dicSEXP);
+    Rcpp::traits::input_parameter< List >::type filter(filterSEXP);
+    Rcpp::traits::input_parameter< std::string >::type collapse(collapseSEXP);
+    Rcpp::traits::input_parameter< std::string >::type normalize(normalizeSEXP);
+    rcpp_result_gen = Rcpp::wrap(posParallelPackRcpp(text, sys_dic, user_dic, filter, collapse, normalize));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_posParallelPackRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP collapseSEXP, SEXP normalizeSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_posParallelPackRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP, filterSEXP, collapseSEXP, normalizeSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// posStatsRcpp
+SEXP posStatsRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, std::string normalize);
+static SEXP _RcppMeCab_posStatsRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP normalizeSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
     Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
     Rcpp::traits::input_parameter< std::string >::type user_dic(user_dicSEXP);
-    rcpp_result_gen = Rcpp::wrap(posLoopDFRcpp(text, sys_dic, user_dic));
+    Rcpp::traits::input_parameter< List >::type filter(filterSEXP);
+    Rcpp::traits::input_parameter< std::string >::type normalize(normalizeSEXP);
+    rcpp_result_gen = Rcpp::wrap(posStatsRcpp(text, sys_dic, user_dic, filter, normalize));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_posStatsRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP normalizeSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_posStatsRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP, filterSEXP, normalizeSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// writeTokensRcpp
+List writeTokensRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, std::string file, std::vector<std::string> doc_names, int batch_size);
+static SEXP _RcppMeCab_writeTokensRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP fileSEXP, SEXP doc_namesSEXP, SEXP batch_sizeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
+    Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
+    Rcpp::traits::input_parameter< std::string >::type user_dic(user_dicSEXP);
+    Rcpp::traits::input_parameter< List >::type filter(filterSEXP);
+    Rcpp::traits::input_parameter< std::string >::type file(fileSEXP);
+    Rcpp::traits::input_parameter< std::vector<std::string> >::type doc_names(doc_namesSEXP);
+    Rcpp::traits::input_parameter< int >::type batch_size(batch_sizeSEXP);
+    rcpp_result_gen = Rcpp::wrap(writeTokensRcpp(text, sys_dic, user_dic, filter, file, doc_names, batch_size));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_writeTokensRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP fileSEXP, SEXP doc_namesSEXP, SEXP batch_sizeSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_writeTokensRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP, filterSEXP, fileSEXP, doc_namesSEXP, batch_sizeSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// posParallelArrowRcpp
+SEXP posParallelArrowRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, std::vector<std::string> doc_names, int batch_size, SEXP stream, std::string normalize);
+static SEXP _RcppMeCab_posParallelArrowRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP doc_namesSEXP, SEXP batch_sizeSEXP, SEXP streamSEXP, SEXP normalizeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
+    Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
+    Rcpp::traits::input_parameter< std::string >::type user_dic(user_dicSEXP);
+    Rcpp::traits::input_parameter< List >::type filter(filterSEXP);
+    Rcpp::traits::input_parameter< std::vector<std::string> >::type doc_names(doc_namesSEXP);
+    Rcpp::traits::input_parameter< int >::type batch_size(batch_sizeSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type stream(streamSEXP);
+    Rcpp::traits::input_parameter< std::string >::type normalize(normalizeSEXP);
+    rcpp_result_gen = Rcpp::wrap(posParallelArrowRcpp(text, sys_dic, user_dic, filter, doc_names, batch_size, stream, normalize));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_posParallelArrowRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP doc_namesSEXP, SEXP batch_sizeSEXP, SEXP streamSEXP, SEXP normalizeSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_posParallelArrowRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP, filterSEXP, doc_namesSEXP, batch_sizeSEXP, streamSEXP, normalizeSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// mecabServeRcpp
+SEXP mecabServeRcpp(std::string socket, std::string sys_dic, std::string user_dic, int threads);
+static SEXP _RcppMeCab_mecabServeRcpp_try(SEXP socketSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP threadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< std::string >::type socket(socketSEXP);
+    Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
+    Rcpp::traits::input_parameter< std::string >::type user_dic(user_dicSEXP);
+    Rcpp::traits::input_parameter< int >::type threads(threadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(mecabServeRcpp(socket, sys_dic, user_dic, threads));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_mecabServeRcpp(SEXP socketSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP threadsSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_mecabServeRcpp_try(socketSEXP, sys_dicSEXP, user_dicSEXP, threadsSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// mecabServerStopRcpp
+bool mecabServerStopRcpp(std::string socket);
+static SEXP _RcppMeCab_mecabServerStopRcpp_try(SEXP socketSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< std::string >::type socket(socketSEXP);
+    rcpp_result_gen = Rcpp::wrap(mecabServerStopRcpp(socket));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_mecabServerStopRcpp(SEXP socketSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_mecabServerStopRcpp_try(socketSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// mecabServerSendRcpp
+StringVector mecabServerSendRcpp(std::string socket, RawVector frame);
+static SEXP _RcppMeCab_mecabServerSendRcpp_try(SEXP socketSEXP, SEXP frameSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< std::string >::type socket(socketSEXP);
+    Rcpp::traits::input_parameter< RawVector >::type frame(frameSEXP);
+    rcpp_result_gen = Rcpp::wrap(mecabServerSendRcpp(socket, frame));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_mecabServerSendRcpp(SEXP socketSEXP, SEXP frameSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_mecabServerSendRcpp_try(socketSEXP, frameSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// posServerRcpp
+SEXP posServerRcpp(std::string socket, StringVector text, std::string format, List filter, std::string normalize);
+static SEXP _RcppMeCab_posServerRcpp_try(SEXP socketSEXP, SEXP textSEXP, SEXP formatSEXP, SEXP filterSEXP, SEXP normalizeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< std::string >::type socket(socketSEXP);
+    Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
+    Rcpp::traits::input_parameter< std::string >::type format(formatSEXP);
+    Rcpp::traits::input_parameter< List >::type filter(filterSEXP);
+    Rcpp::traits::input_parameter< std::string >::type normalize(normalizeSEXP);
+    rcpp_result_gen = Rcpp::wrap(posServerRcpp(socket, text, format, filter, normalize));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_posServerRcpp(SEXP socketSEXP, SEXP textSEXP, SEXP formatSEXP, SEXP filterSEXP, SEXP normalizeSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_posServerRcpp_try(socketSEXP, textSEXP, formatSEXP, filterSEXP, normalizeSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// posAsyncRcpp
+SEXP posAsyncRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, std::string format, std::string offset, bool expand, std::string normalize);
+static SEXP _RcppMeCab_posAsyncRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP formatSEXP, SEXP offsetSEXP, SEXP expandSEXP, SEXP normalizeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
+    Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
+    Rcpp::traits::input_parameter< std::string >::type user_dic(user_dicSEXP);
+    Rcpp::traits::input_parameter< List >::type filter(filterSEXP);
+    Rcpp::traits::input_parameter< std::string >::type format(formatSEXP);
+    Rcpp::traits::input_parameter< std::string >::type offset(offsetSEXP);
+    Rcpp::traits::input_parameter< bool >::type expand(expandSEXP);
+    Rcpp::traits::input_parameter< std::string >::type normalize(normalizeSEXP);
+    rcpp_result_gen = Rcpp::wrap(posAsyncRcpp(text, sys_dic, user_dic, filter, format, offset, expand, normalize));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_posAsyncRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP formatSEXP, SEXP offsetSEXP, SEXP expandSEXP, SEXP normalizeSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_posAsyncRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP, filterSEXP, formatSEXP, offsetSEXP, expandSEXP, normalizeSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// posAsyncStatusRcpp
+List posAsyncStatusRcpp(SEXP pointer);
+static SEXP _RcppMeCab_posAsyncStatusRcpp_try(SEXP pointerSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type pointer(pointerSEXP);
+    rcpp_result_gen = Rcpp::wrap(posAsyncStatusRcpp(pointer));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_posAsyncStatusRcpp(SEXP pointerSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_posAsyncStatusRcpp_try(pointerSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// posAsyncCancelRcpp
+bool posAsyncCancelRcpp(SEXP pointer);
+static SEXP _RcppMeCab_posAsyncCancelRcpp_try(SEXP pointerSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type pointer(pointerSEXP);
+    rcpp_result_gen = Rcpp::wrap(posAsyncCancelRcpp(pointer));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_posAsyncCancelRcpp(SEXP pointerSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_posAsyncCancelRcpp_try(pointerSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// posAsyncCollectRcpp
+SEXP posAsyncCollectRcpp(SEXP pointer, StringVector text);
+static SEXP _RcppMeCab_posAsyncCollectRcpp_try(SEXP pointerSEXP, SEXP textSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type pointer(pointerSEXP);
+    Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
+    rcpp_result_gen = Rcpp::wrap(posAsyncCollectRcpp(pointer, text));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_posAsyncCollectRcpp(SEXP pointerSEXP, SEXP textSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_posAsyncCollectRcpp_try(pointerSEXP, textSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// posLatticeRcpp
+DataFrame posLatticeRcpp(StringVector text, std::string sys_dic, std::string user_dic, bool marginal, std::string normalize);
+static SEXP _RcppMeCab_posLatticeRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP marginalSEXP, SEXP normalizeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
+    Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
+    Rcpp::traits::input_parameter< std::string >::type user_dic(user_dicSEXP);
+    Rcpp::traits::input_parameter< bool >::type marginal(marginalSEXP);
+    Rcpp::traits::input_parameter< std::string >::type normalize(normalizeSEXP);
+    rcpp_result_gen = Rcpp::wrap(posLatticeRcpp(text, sys_dic, user_dic, marginal, normalize));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_posLatticeRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP marginalSEXP, SEXP normalizeSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_posLatticeRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP, marginalSEXP, normalizeSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// posApplyRcpp
+List posApplyRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter);
+static SEXP _RcppMeCab_posApplyRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
+    Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
+    Rcpp::traits::input_parameter< std::string >::type user_dic(user_dicSEXP);
+    Rcpp::traits::input_parameter< List >::type filter(filterSEXP);
+    rcpp_result_gen = Rcpp::wrap(posApplyRcpp(text, sys_dic, user_dic, filter));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_posApplyRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_posApplyRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP, filterSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// posApplyJoinRcpp
+List posApplyJoinRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter);
+static SEXP _RcppMeCab_posApplyJoinRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
+    Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
+    Rcpp::traits::input_parameter< std::string >::type user_dic(user_dicSEXP);
+    Rcpp::traits::input_parameter< List >::type filter(filterSEXP);
+    rcpp_result_gen = Rcpp::wrap(posApplyJoinRcpp(text, sys_dic, user_dic, filter));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_posApplyJoinRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_posApplyJoinRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP, filterSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// posWakatiRcpp
+List posWakatiRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter);
+static SEXP _RcppMeCab_posWakatiRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
+    Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
+    Rcpp::traits::input_parameter< std::string >::type user_dic(user_dicSEXP);
+    Rcpp::traits::input_parameter< List >::type filter(filterSEXP);
+    rcpp_result_gen = Rcpp::wrap(posWakatiRcpp(text, sys_dic, user_dic, filter));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_posWakatiRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_posWakatiRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP, filterSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// posLoopDFRcpp
+DataFrame posLoopDFRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, std::string offset, bool expand, bool eojeol);
+static SEXP _RcppMeCab_posLoopDFRcpp_try(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP offsetSEXP, SEXP expandSEXP, SEXP eojeolSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
+    Rcpp::traits::input_parameter< std::string >::type sys_dic(sys_dicSEXP);
+    Rcpp::traits::input_parameter< std::string >::type user_dic(user_dicSEXP);
+    Rcpp::traits::input_parameter< List >::type filter(filterSEXP);
+    Rcpp::traits::input_parameter< std::string >::type offset(offsetSEXP);
+    Rcpp::traits::input_parameter< bool >::type expand(expandSEXP);
+    Rcpp::traits::input_parameter< bool >::type eojeol(eojeolSEXP);
+    rcpp_result_gen = Rcpp::wrap(posLoopDFRcpp(text, sys_dic, user_dic, filter, offset, expand, eojeol));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_posLoopDFRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP, SEXP filterSEXP, SEXP offsetSEXP, SEXP expandSEXP, SEXP eojeolSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_posLoopDFRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP, filterSEXP, offsetSEXP, expandSEXP, eojeolSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// tokenStoreOpenRcpp
+List tokenStoreOpenRcpp(std::string file);
+static SEXP _RcppMeCab_tokenStoreOpenRcpp_try(SEXP fileSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< std::string >::type file(fileSEXP);
+    rcpp_result_gen = Rcpp::wrap(tokenStoreOpenRcpp(file));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_tokenStoreOpenRcpp(SEXP fileSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_tokenStoreOpenRcpp_try(fileSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// tokenStoreColumnRcpp
+SEXP tokenStoreColumnRcpp(SEXP pointer, std::string column);
+static SEXP _RcppMeCab_tokenStoreColumnRcpp_try(SEXP pointerSEXP, SEXP columnSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type pointer(pointerSEXP);
+    Rcpp::traits::input_parameter< std::string >::type column(columnSEXP);
+    rcpp_result_gen = Rcpp::wrap(tokenStoreColumnRcpp(pointer, column));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_tokenStoreColumnRcpp(SEXP pointerSEXP, SEXP columnSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_tokenStoreColumnRcpp_try(pointerSEXP, columnSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// tokenStoreDocsRcpp
+List tokenStoreDocsRcpp(SEXP pointer, std::vector<int> docs, std::vector<int> doc_id);
+static SEXP _RcppMeCab_tokenStoreDocsRcpp_try(SEXP pointerSEXP, SEXP docsSEXP, SEXP doc_idSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type pointer(pointerSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type docs(docsSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type doc_id(doc_idSEXP);
+    rcpp_result_gen = Rcpp::wrap(tokenStoreDocsRcpp(pointer, docs, doc_id));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _RcppMeCab_tokenStoreDocsRcpp(SEXP pointerSEXP, SEXP docsSEXP, SEXP doc_idSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_RcppMeCab_tokenStoreDocsRcpp_try(pointerSEXP, docsSEXP, doc_idSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error(CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// contentHashRcpp
+StringVector contentHashRcpp(StringVector text);
+static SEXP _RcppMeCab_contentHashRcpp_try(SEXP textSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< StringVector >::type text(textSEXP);
+    rcpp_result_gen = Rcpp::wrap(contentHashRcpp(text));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _RcppMeCab_posLoopDFRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP user_dicSEXP) {
+RcppExport SEXP _RcppMeCab_contentHashRcpp(SEXP textSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_RcppMeCab_posLoopDFRcpp_try(textSEXP, sys_dicSEXP, user_dicSEXP));
+        rcpp_result_gen = PROTECT(_RcppMeCab_contentHashRcpp_try(textSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -229,40 +1246,123 @@ RcppExport SEXP _RcppMeCab_posLoopDFRcpp(SEXP textSEXP, SEXP sys_dicSEXP, SEXP u
 static int _RcppMeCab_RcppExport_validate(const char* sig) { 
     static std::set<std::string> signatures;
     if (signatures.empty()) {
-        signatures.insert("List(*posParallelJoinRcpp)(std::vector<std::string>,std::string,std::string)");
-        signatures.insert("DataFrame(*posParallelDFRcpp)(StringVector,std::string,std::string)");
-        signatures.insert("List(*posParallelRcpp)(std::vector<std::string>,std::string,std::string)");
-        signatures.insert("List(*posApplyRcpp)(StringVector,std::string,std::string)");
-        signatures.insert("List(*posApplyJoinRcpp)(StringVector,std::string,std::string)");
-        signatures.insert("DataFrame(*posLoopDFRcpp)(StringVector,std::string,std::string)");
+        signatures.insert("List(*dictionaryInfoRcpp)(std::string,std::string)");
+        signatures.insert("List(*dicSchemaColumnsRcpp)(std::string,int)");
+        signatures.insert("List(*compileUserDicRcpp)(std::vector<std::string>,std::string,std::string,bool)");
+        signatures.insert("List(*packRcpp)(IntegerVector,StringVector,std::string)");
+        signatures.insert("List(*posParallelJoinRcpp)(StringVector,std::string,std::string,List,std::string)");
+        signatures.insert("DataFrame(*posParallelDFRcpp)(StringVector,std::string,std::string,List,std::string,bool,std::string,bool)");
+        signatures.insert("DataFrame(*posParallelMultiDFRcpp)(StringVector,std::vector<std::string>,std::vector<std::string>,List,std::string,bool,std::string)");
+        signatures.insert("List(*posParallelRcpp)(StringVector,std::string,std::string,List,std::string)");
+        signatures.insert("List(*posParallelWakatiRcpp)(StringVector,std::string,std::string,List,std::string)");
+        signatures.insert("List(*posParallelFlatRcpp)(StringVector,std::string,std::string,List,std::string)");
+        signatures.insert("List(*posParallelIdsRcpp)(StringVector,std::string,std::string,List,bool,std::vector<std::string>,std::string)");
+        signatures.insert("List(*posParallelNgramRcpp)(StringVector,std::string,std::string,List,int,int,std::string,bool,std::string,std::string)");
+        signatures.insert("DataFrame(*posParallelPackRcpp)(StringVector,std::string,std::string,List,std::string,std::string)");
+        signatures.insert("SEXP(*posStatsRcpp)(StringVector,std::string,std::string,List,std::string)");
+        signatures.insert("List(*writeTokensRcpp)(StringVector,std::string,std::string,List,std::string,std::vector<std::string>,int)");
+        signatures.insert("SEXP(*posParallelArrowRcpp)(StringVector,std::string,std::string,List,std::vector<std::string>,int,SEXP,std::string)");
+        signatures.insert("SEXP(*mecabServeRcpp)(std::string,std::string,std::string,int)");
+        signatures.insert("bool(*mecabServerStopRcpp)(std::string)");
+        signatures.insert("StringVector(*mecabServerSendRcpp)(std::string,RawVector)");
+        signatures.insert("SEXP(*posServerRcpp)(std::string,StringVector,std::string,List,std::string)");
+        signatures.insert("SEXP(*posAsyncRcpp)(StringVector,std::string,std::string,List,std::string,std::string,bool,std::string)");
+        signatures.insert("List(*posAsyncStatusRcpp)(SEXP)");
+        signatures.insert("bool(*posAsyncCancelRcpp)(SEXP)");
+        signatures.insert("SEXP(*posAsyncCollectRcpp)(SEXP,StringVector)");
+        signatures.insert("DataFrame(*posLatticeRcpp)(StringVector,std::string,std::string,bool,std::string)");
+        signatures.insert("List(*posApplyRcpp)(StringVector,std::string,std::string,List)");
+        signatures.insert("List(*posApplyJoinRcpp)(StringVector,std::string,std::string,List)");
+        signatures.insert("List(*posWakatiRcpp)(StringVector,std::string,std::string,List)");
+        signatures.insert("DataFrame(*posLoopDFRcpp)(StringVector,std::string,std::string,List,std::string,bool,bool)");
+        signatures.insert("List(*tokenStoreOpenRcpp)(std::string)");
+        signatures.insert("SEXP(*tokenStoreColumnRcpp)(SEXP,std::string)");
+        signatures.insert("List(*tokenStoreDocsRcpp)(SEXP,std::vector<int>,std::vector<int>)");
+        signatures.insert("StringVector(*contentHashRcpp)(StringVector)");
     }
     return signatures.find(sig) != signatures.end();
 }
 
 // registerCCallable (register entry points for exported C++ functions)
 RcppExport SEXP _RcppMeCab_RcppExport_registerCCallable() { 
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_dictionaryInfoRcpp", (DL_FUNC)_RcppMeCab_dictionaryInfoRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_dicSchemaColumnsRcpp", (DL_FUNC)_RcppMeCab_dicSchemaColumnsRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_compileUserDicRcpp", (DL_FUNC)_RcppMeCab_compileUserDicRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_packRcpp", (DL_FUNC)_RcppMeCab_packRcpp_try);
     R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posParallelJoinRcpp", (DL_FUNC)_RcppMeCab_posParallelJoinRcpp_try);
     R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posParallelDFRcpp", (DL_FUNC)_RcppMeCab_posParallelDFRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posParallelMultiDFRcpp", (DL_FUNC)_RcppMeCab_posParallelMultiDFRcpp_try);
     R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posParallelRcpp", (DL_FUNC)_RcppMeCab_posParallelRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posParallelWakatiRcpp", (DL_FUNC)_RcppMeCab_posParallelWakatiRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posParallelFlatRcpp", (DL_FUNC)_RcppMeCab_posParallelFlatRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posParallelIdsRcpp", (DL_FUNC)_RcppMeCab_posParallelIdsRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posParallelNgramRcpp", (DL_FUNC)_RcppMeCab_posParallelNgramRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posParallelPackRcpp", (DL_FUNC)_RcppMeCab_posParallelPackRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posStatsRcpp", (DL_FUNC)_RcppMeCab_posStatsRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_writeTokensRcpp", (DL_FUNC)_RcppMeCab_writeTokensRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posParallelArrowRcpp", (DL_FUNC)_RcppMeCab_posParallelArrowRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_mecabServeRcpp", (DL_FUNC)_RcppMeCab_mecabServeRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_mecabServerStopRcpp", (DL_FUNC)_RcppMeCab_mecabServerStopRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_mecabServerSendRcpp", (DL_FUNC)_RcppMeCab_mecabServerSendRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posServerRcpp", (DL_FUNC)_RcppMeCab_posServerRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posAsyncRcpp", (DL_FUNC)_RcppMeCab_posAsyncRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posAsyncStatusRcpp", (DL_FUNC)_RcppMeCab_posAsyncStatusRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posAsyncCancelRcpp", (DL_FUNC)_RcppMeCab_posAsyncCancelRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posAsyncCollectRcpp", (DL_FUNC)_RcppMeCab_posAsyncCollectRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posLatticeRcpp", (DL_FUNC)_RcppMeCab_posLatticeRcpp_try);
     R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posApplyRcpp", (DL_FUNC)_RcppMeCab_posApplyRcpp_try);
     R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posApplyJoinRcpp", (DL_FUNC)_RcppMeCab_posApplyJoinRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posWakatiRcpp", (DL_FUNC)_RcppMeCab_posWakatiRcpp_try);
     R_RegisterCCallable("RcppMeCab", "_RcppMeCab_posLoopDFRcpp", (DL_FUNC)_RcppMeCab_posLoopDFRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_tokenStoreOpenRcpp", (DL_FUNC)_RcppMeCab_tokenStoreOpenRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_tokenStoreColumnRcpp", (DL_FUNC)_RcppMeCab_tokenStoreColumnRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_tokenStoreDocsRcpp", (DL_FUNC)_RcppMeCab_tokenStoreDocsRcpp_try);
+    R_RegisterCCallable("RcppMeCab", "_RcppMeCab_contentHashRcpp", (DL_FUNC)_RcppMeCab_contentHashRcpp_try);
     R_RegisterCCallable("RcppMeCab", "_RcppMeCab_RcppExport_validate", (DL_FUNC)_RcppMeCab_RcppExport_validate);
     return R_NilValue;
 }
 
 static const R_CallMethodDef CallEntries[] = {
-    {"_RcppMeCab_posParallelJoinRcpp", (DL_FUNC) &_RcppMeCab_posParallelJoinRcpp, 3},
-    {"_RcppMeCab_posParallelDFRcpp", (DL_FUNC) &_RcppMeCab_posParallelDFRcpp, 3},
-    {"_RcppMeCab_posParallelRcpp", (DL_FUNC) &_RcppMeCab_posParallelRcpp, 3},
-    {"_RcppMeCab_posApplyRcpp", (DL_FUNC) &_RcppMeCab_posApplyRcpp, 3},
-    {"_RcppMeCab_posApplyJoinRcpp", (DL_FUNC) &_RcppMeCab_posApplyJoinRcpp, 3},
-    {"_RcppMeCab_posLoopDFRcpp", (DL_FUNC) &_RcppMeCab_posLoopDFRcpp, 3},
+    {"_RcppMeCab_dictionaryInfoRcpp", (DL_FUNC) &_RcppMeCab_dictionaryInfoRcpp, 2},
+    {"_RcppMeCab_dicSchemaColumnsRcpp", (DL_FUNC) &_RcppMeCab_dicSchemaColumnsRcpp, 2},
+    {"_RcppMeCab_compileUserDicRcpp", (DL_FUNC) &_RcppMeCab_compileUserDicRcpp, 4},
+    {"_RcppMeCab_packRcpp", (DL_FUNC) &_RcppMeCab_packRcpp, 3},
+    {"_RcppMeCab_posParallelJoinRcpp", (DL_FUNC) &_RcppMeCab_posParallelJoinRcpp, 5},
+    {"_RcppMeCab_posParallelDFRcpp", (DL_FUNC) &_RcppMeCab_posParallelDFRcpp, 8},
+    {"_RcppMeCab_posParallelMultiDFRcpp", (DL_FUNC) &_RcppMeCab_posParallelMultiDFRcpp, 7},
+    {"_RcppMeCab_posParallelRcpp", (DL_FUNC) &_RcppMeCab_posParallelRcpp, 5},
+    {"_RcppMeCab_posParallelWakatiRcpp", (DL_FUNC) &_RcppMeCab_posParallelWakatiRcpp, 5},
+    {"_RcppMeCab_posParallelFlatRcpp", (DL_FUNC) &_RcppMeCab_posParallelFlatRcpp, 5},
+    {"_RcppMeCab_posParallelIdsRcpp", (DL_FUNC) &_RcppMeCab_posParallelIdsRcpp, 7},
+    {"_RcppMeCab_posParallelNgramRcpp", (DL_FUNC) &_RcppMeCab_posParallelNgramRcpp, 10},
+    {"_RcppMeCab_posParallelPackRcpp", (DL_FUNC) &_RcppMeCab_posParallelPackRcpp, 6},
+    {"_RcppMeCab_posStatsRcpp", (DL_FUNC) &_RcppMeCab_posStatsRcpp, 5},
+    {"_RcppMeCab_writeTokensRcpp", (DL_FUNC) &_RcppMeCab_writeTokensRcpp, 7},
+    {"_RcppMeCab_posParallelArrowRcpp", (DL_FUNC) &_RcppMeCab_posParallelArrowRcpp, 8},
+    {"_RcppMeCab_mecabServeRcpp", (DL_FUNC) &_RcppMeCab_mecabServeRcpp, 4},
+    {"_RcppMeCab_mecabServerStopRcpp", (DL_FUNC) &_RcppMeCab_mecabServerStopRcpp, 1},
+    {"_RcppMeCab_mecabServerSendRcpp", (DL_FUNC) &_RcppMeCab_mecabServerSendRcpp, 2},
+    {"_RcppMeCab_posServerRcpp", (DL_FUNC) &_RcppMeCab_posServerRcpp, 5},
+    {"_RcppMeCab_posAsyncRcpp", (DL_FUNC) &_RcppMeCab_posAsyncRcpp, 8},
+    {"_RcppMeCab_posAsyncStatusRcpp", (DL_FUNC) &_RcppMeCab_posAsyncStatusRcpp, 1},
+    {"_RcppMeCab_posAsyncCancelRcpp", (DL_FUNC) &_RcppMeCab_posAsyncCancelRcpp, 1},
+    {"_RcppMeCab_posAsyncCollectRcpp", (DL_FUNC) &_RcppMeCab_posAsyncCollectRcpp, 2},
+    {"_RcppMeCab_posLatticeRcpp", (DL_FUNC) &_RcppMeCab_posLatticeRcpp, 5},
+    {"_RcppMeCab_posApplyRcpp", (DL_FUNC) &_RcppMeCab_posApplyRcpp, 4},
+    {"_RcppMeCab_posApplyJoinRcpp", (DL_FUNC) &_RcppMeCab_posApplyJoinRcpp, 4},
+    {"_RcppMeCab_posWakatiRcpp", (DL_FUNC) &_RcppMeCab_posWakatiRcpp, 4},
+    {"_RcppMeCab_posLoopDFRcpp", (DL_FUNC) &_RcppMeCab_posLoopDFRcpp, 7},
+    {"_RcppMeCab_tokenStoreOpenRcpp", (DL_FUNC) &_RcppMeCab_tokenStoreOpenRcpp, 1},
+    {"_RcppMeCab_tokenStoreColumnRcpp", (DL_FUNC) &_RcppMeCab_tokenStoreColumnRcpp, 2},
+    {"_RcppMeCab_tokenStoreDocsRcpp", (DL_FUNC) &_RcppMeCab_tokenStoreDocsRcpp, 3},
+    {"_RcppMeCab_contentHashRcpp", (DL_FUNC) &_RcppMeCab_contentHashRcpp, 1},
     {"_RcppMeCab_RcppExport_registerCCallable", (DL_FUNC) &_RcppMeCab_RcppExport_registerCCallable, 0},
     {NULL, NULL, 0}
 };
 
+void registerLazyStrings(DllInfo* dll);
 RcppExport void R_init_RcppMeCab(DllInfo *dll) {
     R_registerRoutines(dll, NULL, CallEntries, NULL, NULL);
     R_useDynamicSymbols(dll, FALSE);
+    registerLazyStrings(dll);
 }
@@ -0,0 +1,255 @@
+#ifndef RCPPMECAB_ARROWEXPORT_H
+#define RCPPMECAB_ARROWEXPORT_H
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Arrow C data and stream interfaces, as given in the Arrow specification.
+// https://arrow.apache.org/docs/format/CDataInterface.html
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+  const char* format;
+  const char* name;
+  const char* metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema** children;
+  struct ArrowSchema* dictionary;
+  void (*release)(struct ArrowSchema*);
+  void* private_data;
+};
+
+struct ArrowArray {
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void** buffers;
+  struct ArrowArray** children;
+  struct ArrowArray* dictionary;
+  void (*release)(struct ArrowArray*);
+  void* private_data;
+};
+
+#endif
+
+#ifndef ARROW_C_STREAM_INTERFACE
+#define ARROW_C_STREAM_INTERFACE
+
+struct ArrowArrayStream {
+  int (*get_schema)(struct ArrowArrayStream*, struct ArrowSchema* out);
+  int (*get_next)(struct ArrowArrayStream*, struct ArrowArray* out);
+  const char* (*get_last_error)(struct ArrowArrayStream*);
+  void (*release)(struct ArrowArrayStream*);
+  void* private_data;
+};
+
+#endif
+
+namespace arrowexport {
+
+// ---------------------------------------------------------------- schema
+
+struct SchemaData
+{
+  std::string format;
+  std::string name;
+  std::vector<ArrowSchema> children;
+  std::vector<ArrowSchema*> child_ptrs;
+  ArrowSchema dictionary;
+  bool has_dictionary;
+};
+
+inline void releaseSchema(ArrowSchema* schema) {
+  SchemaData* data = static_cast<SchemaData*>(schema->private_data);
+  for (size_t c = 0; c < data->children.size(); ++c) {
+    if (data->children[c].release) {
+      data->children[c].release(&data->children[c]);
+    }
+  }
+  if (data->has_dictionary && data->dictionary.release) {
+    data->dictionary.release(&data->dictionary);
+  }
+  delete data;
+  schema->release = NULL;
+}
+
+inline void makeSchema(ArrowSchema* out, const std::string& format, const std::string& name, bool nullable) {
+  SchemaData* data = new SchemaData();
+  data->format = format;
+  data->name = name;
+  data->has_dictionary = false;
+
+  out->format = data->format.c_str();
+  out->name = data->name.c_str();
+  out->metadata = NULL;
+  out->flags = nullable ? ARROW_FLAG_NULLABLE : 0;
+  out->n_children = 0;
+  out->children = NULL;
+  out->dictionary = NULL;
+  out->release = releaseSchema;
+  out->private_data = data;
+}
+
+// Move `children` into the struct schema `out`.
+inline void setSchemaChildren(ArrowSchema* out, std::vector<ArrowSchema>& children) {
+  SchemaData* data = static_cast<SchemaData*>(out->private_data);
+  data->children.swap(children);
+  for (size_t c = 0; c < data->children.size(); ++c) {
+    data->child_ptrs.push_back(&data->children[c]);
+  }
+  out->n_children = static_cast<int64_t>(data->children.size());
+  out->children = data->child_ptrs.data();
+}
+
+inline void setSchemaDictionary(ArrowSchema* out, const std::string& format) {
+  SchemaData* data = static_cast<SchemaData*>(out->private_data);
+  makeSchema(&data->dictionary, format, "", false);
+  data->has_dictionary = true;
+  out->dictionary = &data->dictionary;
+}
+
+// ---------------------------------------------------------------- arrays
+
+// Offsets and UTF-8 bytes of a string array, which can be shared by the
+// dictionaries of several batches.
+struct StringBuffers
+{
+  std::vector<uint8_t> validity;
+  std::vector<int32_t> offsets;
+  std::string bytes;
+  int64_t null_count;
+
+  StringBuffers() : null_count(0) {
+    offsets.push_back(0);
+  }
+
+  // false if the array would overflow 32-bit offsets
+  bool add(const std::string& value, bool null) {
+    const size_t i = offsets.size() - 1;
+    if (null && validity.empty()) {
+      // every value so far is valid
+      validity.assign(i / 8 + 1, 0xFF);
+    }
+    if (!validity.empty()) {
+      if (validity.size() <= i / 8) {
+        validity.push_back(0xFF);
+      }
+      if (null) {
+        validity[i / 8] &= static_cast<uint8_t>(~(1 << (i % 8)));
+        null_count++;
+      }
+    }
+    if (!null) {
+      if (bytes.size() + value.size() > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+        return false;
+      }
+      bytes.append(value);
+    }
+    offsets.push_back(static_cast<int32_t>(bytes.size()));
+    return true;
+  }
+
+  int64_t length() const {
+    return static_cast<int64_t>(offsets.size()) - 1;
+  }
+};
+
+struct ArrayData
+{
+  std::vector<int32_t> values;
+  std::shared_ptr<const StringBuffers> strings;
+  std::vector<const void*> buffers;
+  std::vector<ArrowArray> children;
+  std::vector<ArrowArray*> child_ptrs;
+  ArrowArray dictionary;
+  bool has_dictionary;
+};
+
+inline void releaseArray(ArrowArray* array) {
+  ArrayData* data = static_cast<ArrayData*>(array->private_data);
+  for (size_t c = 0; c < data->children.size(); ++c) {
+    if (data->children[c].release) {
+      data->children[c].release(&data->children[c]);
+    }
+  }
+  if (data->has_dictionary && data->dictionary.release) {
+    data->dictionary.release(&data->dictionary);
+  }
+  delete data;
+  array->release = NULL;
+}
+
+inline ArrayData* initArray(ArrowArray* out, int64_t length) {
+  ArrayData* data = new ArrayData();
+  data->has_dictionary = false;
+
+  out->length = length;
+  out->null_count = 0;
+  out->offset = 0;
+  out->n_buffers = 0;
+  out->n_children = 0;
+  out->buffers = NULL;
+  out->children = NULL;
+  out->dictionary = NULL;
+  out->release = releaseArray;
+  out->private_data = data;
+  return data;
+}
+
+inline void makeInt32Array(ArrowArray* out, std::vector<int32_t>& values) {
+  ArrayData* data = initArray(out, static_cast<int64_t>(values.size()));
+  data->values.swap(values);
+  data->buffers.push_back(NULL);
+  data->buffers.push_back(data->values.data());
+  out->n_buffers = 2;
+  out->buffers = data->buffers.data();
+}
+
+inline void makeStringArray(ArrowArray* out, const std::shared_ptr<const StringBuffers>& strings) {
+  ArrayData* data = initArray(out, strings->length());
+  data->strings = strings;
+  data->buffers.push_back(strings->validity.empty() ? NULL : strings->validity.data());
+  data->buffers.push_back(strings->offsets.data());
+  data->buffers.push_back(strings->bytes.data());
+  out->null_count = strings->null_count;
+  out->n_buffers = 3;
+  out->buffers = data->buffers.data();
+}
+
+inline void makeStructArray(ArrowArray* out, int64_t length, std::vector<ArrowArray>& children) {
+  ArrayData* data = initArray(out, length);
+  data->buffers.push_back(NULL);
+  data->children.swap(children);
+  for (size_t c = 0; c < data->children.size(); ++c) {
+    data->child_ptrs.push_back(&data->children[c]);
+  }
+  out->n_buffers = 1;
+  out->buffers = data->buffers.data();
+  out->n_children = static_cast<int64_t>(data->children.size());
+  out->children = data->child_ptrs.data();
+}
+
+inline void setArrayDictionary(ArrowArray* out, const std::shared_ptr<const StringBuffers>& strings) {
+  ArrayData* data = static_cast<ArrayData*>(out->private_data);
+  makeStringArray(&data->dictionary, strings);
+  data->has_dictionary = true;
+  out->dictionary = &data->dictionary;
+}
+
+}
+
+#endif
@@ -0,0 +1,39 @@
+// [[Rcpp::plugins(cpp11)]]
+
+#include <exception>
+#include <thread>
+#include "asyncJob.h"
+
+struct AsyncJob::Thread
+{
+  std::thread thread;
+};
+
+AsyncJob::AsyncJob(size_t total)
+  : total_(total), completed_(0), cancelled_(false), finished_(false)
+{}
+
+AsyncJob::~AsyncJob() {
+  cancel();
+  wait();
+}
+
+void AsyncJob::start(const Work& work) {
+  thread_.reset(new Thread());
+  thread_->thread = std::thread([this, work] {
+    try {
+      work(*this);
+    } catch (std::exception& e) {
+      error_ = e.what();
+    } catch (...) {
+      error_ = "unknown error";
+    }
+    finished_ = true;
+  });
+}
+
+void AsyncJob::wait() {
+  if (thread_ && thread_->thread.joinable()) {
+    thread_->thread.join();
+  }
+}
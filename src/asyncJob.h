@@ -0,0 +1,50 @@
+#ifndef RCPPMECAB_ASYNCJOB_H
+#define RCPPMECAB_ASYNCJOB_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+
+// Work running on a background thread while the R main thread goes on. The
+// work reports the documents it has parsed with `advance()` and stops early
+// once `cancelled()`. The thread is started in asyncJob.cpp, out of reach of
+// RcppThread's override of std::thread.
+class AsyncJob
+{
+public:
+  typedef std::function<void(AsyncJob&)> Work;
+
+  explicit AsyncJob(size_t total);
+
+  // Cancels the work and waits for the thread.
+  ~AsyncJob();
+
+  void start(const Work& work);
+
+  // Blocks until the work returns. Call from the thread that started it.
+  void wait();
+
+  size_t total() const { return total_; }
+  size_t completed() const { return completed_; }
+  bool finished() const { return finished_; }
+  bool cancelled() const { return cancelled_; }
+
+  // Message of an exception thrown by the work; valid once finished.
+  const std::string& error() const { return error_; }
+
+  void advance(size_t n) { completed_ += n; }
+  void cancel() { cancelled_ = true; }
+
+private:
+  struct Thread;
+
+  size_t total_;
+  std::atomic<size_t> completed_;
+  std::atomic<bool> cancelled_;
+  std::atomic<bool> finished_;
+  std::string error_;
+  std::unique_ptr<Thread> thread_;
+};
+
+#endif
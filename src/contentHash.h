@@ -0,0 +1,32 @@
+#ifndef RCPPMECAB_CONTENTHASH_H
+#define RCPPMECAB_CONTENTHASH_H
+
+#include <cstdio>
+#include <string>
+#include <boost/cstdint.hpp>
+
+// 64-bit FNV-1a, enough to tell contents apart in caches and stores; not a
+// cryptographic hash.
+static const boost::uint64_t HASH_BASIS = 14695981039346656037ULL;
+
+inline void hashBytes(boost::uint64_t& hash, const char* data, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= static_cast<unsigned char>(data[i]);
+    hash *= 1099511628211ULL;
+  }
+  // separator, so that ("ab", "c") and ("a", "bc") differ
+  hash ^= 0xFF;
+  hash *= 1099511628211ULL;
+}
+
+inline void hashBytes(boost::uint64_t& hash, const std::string& value) {
+  hashBytes(hash, value.data(), value.size());
+}
+
+inline std::string hashHex(boost::uint64_t hash) {
+  char hex[17];
+  std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+  return std::string(hex, 16);
+}
+
+#endif
@@ -0,0 +1,161 @@
+#ifndef RCPPMECAB_DICSCHEMA_H
+#define RCPPMECAB_DICSCHEMA_H
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <vector>
+#include "../inst/include/mecab.h"
+
+// Feature layout of a system dictionary: which feature fields are emitted as
+// data.frame columns, and under which names. `fields[k]` feeds `columns[k]`.
+struct DicSchema
+{
+  std::string name;
+  std::string filename;
+  std::string charset;
+  size_t arity;
+  std::vector<std::string> columns;
+  std::vector<size_t> fields;
+
+  void add(const char* column, size_t field) {
+    columns.push_back(column);
+    fields.push_back(field);
+  }
+};
+
+inline std::string lowerCase(std::string value) {
+  std::transform(value.begin(), value.end(), value.begin(), ::tolower);
+  return value;
+}
+
+inline size_t featureArity(const char* feature) {
+  size_t n = 1;
+  for (const char* p = feature; *p; ++p) {
+    if (*p == ',') {
+      n++;
+    }
+  }
+  return n;
+}
+
+// Parse a few short probes and return the number of feature fields of the
+// first dictionary (non-unknown) node. Unknown-word features are shorter
+// than the dictionary ones, so they are not used for the probe.
+inline size_t probeFeatureArity(mecab_model_t* model) {
+  static const char* probes[] = {
+    "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E",  // Japanese
+    "\xED\x95\x9C\xEA\xB5\xAD\xEC\x96\xB4",  // Korean
+    "the"
+  };
+
+  mecab_t* tagger = mecab_model_new_tagger(model);
+  mecab_lattice_t* lattice = mecab_model_new_lattice(model);
+  size_t arity = 0;
+
+  for (size_t i = 0; i < sizeof(probes) / sizeof(probes[0]) && arity == 0; ++i) {
+    mecab_lattice_set_sentence(lattice, probes[i]);
+    mecab_parse_lattice(tagger, lattice);
+    const mecab_node_t* node = mecab_lattice_get_bos_node(lattice);
+    for (; node; node = node->next) {
+      if (node->stat == MECAB_NOR_NODE) {
+        arity = featureArity(node->feature);
+        break;
+      }
+    }
+  }
+
+  mecab_lattice_destroy(lattice);
+  mecab_destroy(tagger);
+  return arity;
+}
+
+// Feature columns of `schema.name`; the UniDic ones also depend on
+// `schema.arity`.
+inline void addDicColumns(DicSchema& schema) {
+  schema.add("pos", 0);
+  schema.add("subtype", 1);
+
+  if (schema.name == "ipadic") {
+    // POS,POS1,POS2,POS3,cType,cForm,base,reading,pronunciation
+    schema.add("base_form", 6);
+    schema.add("reading", 7);
+    schema.add("pronunciation", 8);
+  } else if (schema.name == "unidic") {
+    // pos1-4,cType,cForm,lForm,lemma,orth,pron,orthBase,pronBase,goshu,
+    // iType,iForm,fType,fForm, then kana,kanaBase,... in the 26 fields of
+    // UniDic 2.1.2 and iConType,fConType,type,kana,... in the 29 of 2.2 and
+    // later. lForm is the reading of the lemma, not of the token; the
+    // 17-field layout has no kana of the token at all.
+    schema.add("base_form", 10);
+    schema.add("lemma", 7);
+    schema.add("lemma_reading", 6);
+    if (schema.arity >= 29) {
+      schema.add("reading", 20);
+    } else if (schema.arity >= 26) {
+      schema.add("reading", 17);
+    }
+    schema.add("pronunciation", 9);
+  } else if (schema.name == "jumandic") {
+    // POS,POS1,cType,cForm,base,reading,semantic
+    schema.add("base_form", 4);
+    schema.add("reading", 5);
+  } else if (schema.name == "mecab-ko-dic") {
+    // tag,semantic,jongseong,reading,type,first,last,expression
+    schema.add("reading", 3);
+    schema.add("type", 4);
+    schema.add("first_pos", 5);
+    schema.add("last_pos", 6);
+    schema.add("expression", 7);
+  } else {
+    schema.add("analytic", 7);
+  }
+}
+
+// Detect the dictionary from the system dictionary file name and charset,
+// falling back to the feature arity when the name is not conclusive.
+inline DicSchema detectDicSchema(mecab_model_t* model) {
+  DicSchema schema;
+  schema.arity = 0;
+
+  const mecab_dictionary_info_t* info = mecab_model_dictionary_info(model);
+  for (; info; info = info->next) {
+    if (info->type == MECAB_SYS_DIC) {
+      schema.filename = info->filename ? info->filename : "";
+      schema.charset = info->charset ? info->charset : "";
+      break;
+    }
+  }
+
+  const std::string charset = lowerCase(schema.charset);
+  if (charset == "utf-8" || charset == "utf8") {
+    schema.arity = probeFeatureArity(model);
+  }
+
+  const std::string filename = lowerCase(schema.filename);
+  if (filename.find("unidic") != std::string::npos) {
+    schema.name = "unidic";
+  } else if (filename.find("ko-dic") != std::string::npos || filename.find("kodic") != std::string::npos) {
+    schema.name = "mecab-ko-dic";
+  } else if (filename.find("juman") != std::string::npos) {
+    schema.name = "jumandic";
+  } else if (filename.find("ipadic") != std::string::npos) {
+    schema.name = "ipadic";
+  } else if (schema.arity == 8) {
+    schema.name = "mecab-ko-dic";
+  } else if (schema.arity == 9) {
+    schema.name = "ipadic";
+  } else if (schema.arity == 7) {
+    schema.name = "jumandic";
+  } else if (schema.arity >= 13) {
+    schema.name = "unidic";
+  } else {
+    schema.name = "unknown";
+  }
+
+  addDicColumns(schema);
+
+  return schema;
+}
+
+#endif
@@ -0,0 +1,207 @@
+// [[Rcpp::plugins(cpp11)]]
+// [[Rcpp::depends(BH)]]
+
+#define R_NO_REMAP
+
+#include <Rcpp.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <boost/cstdint.hpp>
+#include "../inst/include/mecab.h"
+#include "dicSchema.h"
+#include "contentHash.h"
+#include "mecabModel.h"
+
+using namespace Rcpp;
+
+//' Inspect MeCab dictionaries and the detected feature schema.
+//'
+//' @param sys_dic String scalar.
+//' @param user_dic String scalar.
+//' @return list.
+//'
+//' @name dictionaryInfoRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+List dictionaryInfoRcpp(std::string sys_dic, std::string user_dic) {
+
+  // create model
+  mecab_model_t* model = newModel(sys_dic, user_dic);
+  if (!model) {
+    return R_NilValue;
+  }
+
+  const DicSchema schema = detectDicSchema(model);
+
+  std::vector<std::string> filename;
+  std::vector<std::string> charset;
+  std::vector<std::string> type;
+  std::vector<int> size;
+  std::vector<int> version;
+
+  const mecab_dictionary_info_t* info = mecab_model_dictionary_info(model);
+  for (; info; info = info->next) {
+    filename.push_back(info->filename ? info->filename : "");
+    charset.push_back(info->charset ? info->charset : "");
+    if (info->type == MECAB_SYS_DIC) {
+      type.push_back("system");
+    } else if (info->type == MECAB_USR_DIC) {
+      type.push_back("user");
+    } else {
+      type.push_back("unknown");
+    }
+    size.push_back(static_cast<int>(info->size));
+    version.push_back(static_cast<int>(info->version));
+  }
+
+  mecab_model_destroy(model);
+
+  return List::create(
+    _["schema"] = schema.name,
+    _["arity"] = static_cast<int>(schema.arity),
+    _["columns"] = wrap(schema.columns),
+    _["dictionaries"] = DataFrame::create(
+      _["filename"] = wrap(filename),
+      _["charset"] = wrap(charset),
+      _["type"] = wrap(type),
+      _["size"] = wrap(size),
+      _["version"] = wrap(version),
+      _["stringsAsFactors"] = false
+    )
+  );
+}
+
+//' Feature columns of a dictionary schema, without loading a dictionary.
+//'
+//' @param name String scalar. Schema name as in `dictionaryInfo()$schema`.
+//' @param arity Integer. Number of feature fields.
+//' @return list of the `columns` and their 1-based feature `fields`.
+//'
+//' @name dicSchemaColumnsRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+List dicSchemaColumnsRcpp(std::string name, int arity) {
+  DicSchema schema;
+  schema.name = name;
+  schema.arity = arity > 0 ? static_cast<size_t>(arity) : 0;
+  addDicColumns(schema);
+
+  std::vector<int> fields;
+  for (size_t f = 0; f < schema.fields.size(); ++f) {
+    fields.push_back(static_cast<int>(schema.fields[f]) + 1);
+  }
+
+  return List::create(
+    _["columns"] = wrap(schema.columns),
+    _["fields"] = wrap(fields)
+  );
+}
+
+//' Compile a user dictionary with `mecab_dict_index`, reusing a cached build.
+//'
+//' @param lines Character vector. Entries in the CSV format of `mecab-dict-index`.
+//' @param sys_dic String scalar.
+//' @param cache_dir String scalar. Existing directory of compiled dictionaries.
+//' @param force Logical. Rebuild even if the cache has the dictionary.
+//' @return list of the compiled `file` and whether it was `cached`.
+//'
+//' @name compileUserDicRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+List compileUserDicRcpp(std::vector<std::string> lines, std::string sys_dic, std::string cache_dir, bool force = false) {
+
+  // create model
+  mecab_model_t* model = newModel(sys_dic, "");
+  if (!model) {
+    return R_NilValue;
+  }
+
+  // the build depends on the entries and on the system dictionary
+  std::string filename;
+  std::string charset;
+  std::string identity;
+  const mecab_dictionary_info_t* info = mecab_model_dictionary_info(model);
+  for (; info; info = info->next) {
+    if (info->type == MECAB_SYS_DIC) {
+      filename = info->filename ? info->filename : "";
+      charset = info->charset ? info->charset : "";
+      std::ostringstream id;
+      id << info->size << ":" << info->lsize << ":" << info->rsize << ":" << info->version;
+      identity = id.str();
+      break;
+    }
+  }
+
+  mecab_model_destroy(model);
+
+  const size_t slash = filename.find_last_of("/\\");
+  if (filename.empty() || slash == std::string::npos) {
+    stop("Cannot locate the system dictionary directory.");
+  }
+  const std::string dicdir = filename.substr(0, slash);
+
+  boost::uint64_t hash = HASH_BASIS;
+  hashBytes(hash, filename);
+  hashBytes(hash, charset);
+  hashBytes(hash, identity);
+  for (size_t i = 0; i < lines.size(); ++i) {
+    hashBytes(hash, lines[i]);
+  }
+  const std::string base = cache_dir + "/user-" + hashHex(hash);
+  const std::string file = base + ".dic";
+
+  if (!force && std::ifstream(file.c_str()).good()) {
+    return List::create(_["file"] = file, _["cached"] = true);
+  }
+
+  const std::string csv = base + ".csv";
+  const std::string partial = base + ".dic.partial";
+  {
+    std::ofstream out(csv.c_str(), std::ios::binary);
+    for (size_t i = 0; i < lines.size(); ++i) {
+      out << lines[i] << '\n';
+    }
+    if (!out) {
+      stop("Cannot write " + csv + ".");
+    }
+  }
+
+  std::vector<std::string> index_args;
+  index_args.push_back("mecab-dict-index");
+  index_args.push_back("-d");
+  index_args.push_back(dicdir);
+  index_args.push_back("-u");
+  index_args.push_back(partial);
+  index_args.push_back("-f");
+  index_args.push_back("utf-8");
+  index_args.push_back("-t");
+  index_args.push_back(charset.empty() ? "utf-8" : charset);
+  index_args.push_back(csv);
+
+  std::vector<char*> argv;
+  for (size_t i = 0; i < index_args.size(); ++i) {
+    argv.push_back(&index_args[i][0]);
+  }
+  argv.push_back(NULL);
+
+  const int status = mecab_dict_index(static_cast<int>(index_args.size()), argv.data());
+  std::remove(csv.c_str());
+
+  // rename last, so a cached file is always a complete build
+  if (status != 0 || std::rename(partial.c_str(), file.c_str()) != 0) {
+    std::remove(partial.c_str());
+    stop("mecab_dict_index failed to compile the user dictionary.");
+  }
+
+  return List::create(_["file"] = file, _["cached"] = false);
+}
@@ -0,0 +1,71 @@
+#ifndef RCPPMECAB_FEATURECACHE_H
+#define RCPPMECAB_FEATURECACHE_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "../inst/include/mecab.h"
+
+// Place of one comma-separated field in a feature string.
+struct FieldSpan
+{
+  FieldSpan(size_t begin, size_t length) : begin(begin), length(length) {}
+
+  size_t begin;
+  size_t length;
+};
+
+// Field spans of the features of known words, keyed by `node->feature`:
+// a known word points into the memory-mapped dictionary, so every occurrence
+// of an entry gives the same pointer and is split only once per thread.
+// Features of unknown words are split every time. The cache lives in the
+// per-thread copy of the data.frame policy (see parseKernel.h), so it is kept
+// across all the ranges a thread parses; it is not thread-safe and must not
+// outlive the model.
+class FeatureCache
+{
+public:
+  FeatureCache() {}
+
+  const std::vector<FieldSpan>& spans(const mecab_node_t* node) {
+    if (node->stat == MECAB_UNK_NODE) {
+      split(node->feature, unknown_);
+      return unknown_;
+    }
+    std::unordered_map<const char*, std::vector<FieldSpan> >::iterator it = cache_.find(node->feature);
+    if (it == cache_.end()) {
+      it = cache_.insert(std::make_pair(node->feature, std::vector<FieldSpan>())).first;
+      split(node->feature, it->second);
+    }
+    return it->second;
+  }
+
+  // Fields as strings, for the callers that need them all.
+  void fields(const mecab_node_t* node, std::vector<std::string>& out) {
+    const std::vector<FieldSpan>& found = spans(node);
+    out.resize(found.size());
+    for (size_t f = 0; f < found.size(); ++f) {
+      out[f].assign(node->feature + found[f].begin, found[f].length);
+    }
+  }
+
+private:
+  // same fields as boost::split() on ","
+  static void split(const char* feature, std::vector<FieldSpan>& out) {
+    out.clear();
+    size_t begin = 0;
+    size_t i = 0;
+    for (; feature[i] != '\0'; ++i) {
+      if (feature[i] == ',') {
+        out.push_back(FieldSpan(begin, i - begin));
+        begin = i + 1;
+      }
+    }
+    out.push_back(FieldSpan(begin, i - begin));
+  }
+
+  std::unordered_map<const char*, std::vector<FieldSpan> > cache_;
+  std::vector<FieldSpan> unknown_;
+};
+
+#endif
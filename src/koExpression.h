@@ -0,0 +1,79 @@
+#ifndef RCPPMECAB_KOEXPRESSION_H
+#define RCPPMECAB_KOEXPRESSION_H
+
+#include <string>
+#include <vector>
+#include "dicSchema.h"
+
+// One morpheme of a mecab-ko-dic expression such as "가/VV/*+았/EP/*".
+struct KoMorpheme
+{
+  std::string surface;
+  std::string pos;
+  std::string semantic;
+};
+
+// Split the expression of an Inflect, Compound or Preanalysis token into its
+// morphemes. Returns false for other tokens, which are kept as they are.
+// `features` is the split feature of a mecab-ko-dic node.
+inline bool splitKoExpression(const std::vector<std::string>& features, std::vector<KoMorpheme>& morphemes) {
+  morphemes.clear();
+  if (features.size() < 8) {
+    return false;
+  }
+  const std::string& type = features[4];
+  const std::string& expression = features[7];
+  if ((type != "Inflect" && type != "Compound" && type != "Preanalysis") || expression == "*") {
+    return false;
+  }
+
+  // "+" separates morphemes only after a "/"; otherwise it is a surface like "+/SY/*"
+  std::vector<std::string> parts;
+  std::string part;
+  for (size_t i = 0; i < expression.size(); ++i) {
+    if (expression[i] == '+' && part.find('/') != std::string::npos) {
+      parts.push_back(part);
+      part.clear();
+    } else {
+      part.push_back(expression[i]);
+    }
+  }
+  parts.push_back(part);
+
+  for (size_t p = 0; p < parts.size(); ++p) {
+    // the surface itself may contain "/", so split from the right
+    const size_t last = parts[p].rfind('/');
+    if (last == std::string::npos || last == 0) {
+      morphemes.clear();
+      return false;
+    }
+    KoMorpheme morpheme;
+    const size_t second = parts[p].rfind('/', last - 1);
+    if (second == std::string::npos || second == 0) {
+      // older dictionaries write "surface/tag"
+      morpheme.surface = parts[p].substr(0, last);
+      morpheme.pos = parts[p].substr(last + 1);
+      morpheme.semantic = "*";
+    } else {
+      morpheme.surface = parts[p].substr(0, second);
+      morpheme.pos = parts[p].substr(second + 1, last - second - 1);
+      morpheme.semantic = parts[p].substr(last + 1);
+    }
+    morphemes.push_back(morpheme);
+  }
+  return true;
+}
+
+// Value of a schema column for a component row of a token of `type`.
+inline std::string koMorphemeField(const std::string& column, const KoMorpheme& morpheme, const std::string& type) {
+  if (column == "pos" || column == "first_pos" || column == "last_pos") {
+    return morpheme.pos;
+  } else if (column == "subtype") {
+    return morpheme.semantic;
+  } else if (column == "type") {
+    return type;
+  }
+  return "*";
+}
+
+#endif
@@ -0,0 +1,275 @@
+// [[Rcpp::plugins(cpp11)]]
+
+#define R_NO_REMAP
+
+#include <Rcpp.h>
+#include <Rversion.h>
+#include "lazyStrings.h"
+#include "stringColumn.h"
+
+#if R_VERSION >= R_Version(3, 5, 0)
+#define RCPPMECAB_ALTREP 1
+#include <R_ext/Altrep.h>
+#endif
+
+using namespace Rcpp;
+
+static SEXP makeChar(const std::string& value, bool star_na) {
+  if (star_na && value.size() == 1 && value[0] == '*') {
+    return NA_STRING;
+  }
+  return Rf_mkCharLenCE(value.data(), static_cast<int>(value.size()), CE_UTF8);
+}
+
+#ifdef RCPPMECAB_ALTREP
+
+// data1 is an external pointer to LazyStrings, data2 the STRSXP of the
+// elements made so far (R_NilValue before the first access).
+struct LazyStrings
+{
+  std::shared_ptr<StringArena> arena;
+  size_t column;
+  bool star_na;
+  std::vector<bool> known;
+  R_xlen_t n_known;
+
+  const std::vector<std::string>& values() const {
+    return arena->columns[column];
+  }
+};
+
+static R_altrep_class_t lazy_strings_class;
+
+static void lazyStringsFinalize(SEXP pointer) {
+  LazyStrings* lazy = static_cast<LazyStrings*>(R_ExternalPtrAddr(pointer));
+  if (lazy) {
+    delete lazy;
+    R_ClearExternalPtr(pointer);
+  }
+}
+
+static LazyStrings* lazyStrings(SEXP x) {
+  return static_cast<LazyStrings*>(R_ExternalPtrAddr(R_altrep_data1(x)));
+}
+
+static R_xlen_t lazyStringsLength(SEXP x) {
+  SEXP cache = R_altrep_data2(x);
+  if (cache != R_NilValue && !lazyStrings(x)->arena) {
+    return XLENGTH(cache);
+  }
+  return static_cast<R_xlen_t>(lazyStrings(x)->values().size());
+}
+
+static SEXP lazyStringsCache(SEXP x) {
+  SEXP cache = R_altrep_data2(x);
+  if (cache == R_NilValue) {
+    cache = Rf_allocVector(STRSXP, lazyStringsLength(x));
+    R_set_altrep_data2(x, cache);
+  }
+  return cache;
+}
+
+// Make every remaining element and release this vector's share of the arena.
+static SEXP lazyStringsMaterialize(SEXP x) {
+  LazyStrings* lazy = lazyStrings(x);
+  SEXP cache = lazyStringsCache(x);
+  if (lazy->arena) {
+    const std::vector<std::string>& values = lazy->values();
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (!lazy->known[i]) {
+        SET_STRING_ELT(cache, i, makeChar(values[i], lazy->star_na));
+      }
+    }
+    lazy->arena.reset();
+    std::vector<bool>().swap(lazy->known);
+  }
+  return cache;
+}
+
+static SEXP lazyStringsElt(SEXP x, R_xlen_t i) {
+  LazyStrings* lazy = lazyStrings(x);
+  SEXP cache = lazyStringsCache(x);
+  if (lazy->arena && !lazy->known[i]) {
+    SET_STRING_ELT(cache, i, makeChar(lazy->values()[i], lazy->star_na));
+    lazy->known[i] = true;
+    lazy->n_known++;
+    if (lazy->n_known == XLENGTH(cache)) {
+      lazyStringsMaterialize(x);
+    }
+  }
+  return STRING_ELT(cache, i);
+}
+
+static void lazyStringsSetElt(SEXP x, R_xlen_t i, SEXP value) {
+  SET_STRING_ELT(lazyStringsMaterialize(x), i, value);
+}
+
+// DATAPTR() is not part of the API; the elements of the materialized vector
+// are made with SET_STRING_ELT() and read through STRING_PTR_RO().
+static void* lazyStringsDataptr(SEXP x, Rboolean writeable) {
+  return const_cast<SEXP*>(STRING_PTR_RO(lazyStringsMaterialize(x)));
+}
+
+static const void* lazyStringsDataptrOrNull(SEXP x) {
+  if (lazyStrings(x)->arena) {
+    return NULL;
+  }
+  return STRING_PTR_RO(R_altrep_data2(x));
+}
+
+// serialized as a plain character vector
+static SEXP lazyStringsSerializedState(SEXP x) {
+  return lazyStringsMaterialize(x);
+}
+
+static SEXP lazyStringsUnserialize(SEXP lazy_class, SEXP state) {
+  return state;
+}
+
+static Rboolean lazyStringsInspect(SEXP x, int pre, int deep, int pvec, void (*inspect_subtree)(SEXP, int, int, int)) {
+  const LazyStrings* lazy = lazyStrings(x);
+  Rprintf("mecab lazy strings (len=%d, materialized=%s)\n",
+          static_cast<int>(lazyStringsLength(x)), lazy->arena ? "F" : "T");
+  return TRUE;
+}
+
+SEXP makeLazyStringColumn(const std::shared_ptr<StringArena>& arena, size_t column, bool star_na) {
+  LazyStrings* lazy = new LazyStrings();
+  lazy->arena = arena;
+  lazy->column = column;
+  lazy->star_na = star_na;
+  lazy->known.assign(arena->columns[column].size(), false);
+  lazy->n_known = 0;
+
+  SEXP pointer = PROTECT(R_MakeExternalPtr(lazy, R_NilValue, R_NilValue));
+  R_RegisterCFinalizerEx(pointer, lazyStringsFinalize, TRUE);
+  SEXP result = PROTECT(R_new_altrep(lazy_strings_class, pointer, R_NilValue));
+
+  if (lazy->known.empty()) {
+    lazyStringsMaterialize(result);
+  }
+  UNPROTECT(2);
+  return result;
+}
+
+#else
+
+SEXP makeLazyStringColumn(const std::shared_ptr<StringArena>& arena, size_t column, bool star_na) {
+  const std::vector<std::string>& values = arena->columns[column];
+  StringVector result(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    SET_STRING_ELT(result, i, makeChar(values[i], star_na));
+  }
+  return result;
+}
+
+#endif
+
+// [[Rcpp::init]]
+void registerLazyStrings(DllInfo* dll) {
+#ifdef RCPPMECAB_ALTREP
+  lazy_strings_class = R_make_altstring_class("mecab_lazy_strings", "RcppMeCab", dll);
+
+  R_set_altrep_Length_method(lazy_strings_class, lazyStringsLength);
+  R_set_altrep_Inspect_method(lazy_strings_class, lazyStringsInspect);
+  R_set_altrep_Serialized_state_method(lazy_strings_class, lazyStringsSerializedState);
+  R_set_altrep_Unserialize_method(lazy_strings_class, lazyStringsUnserialize);
+  R_set_altvec_Dataptr_method(lazy_strings_class, lazyStringsDataptr);
+  R_set_altvec_Dataptr_or_null_method(lazy_strings_class, lazyStringsDataptrOrNull);
+  R_set_altstring_Elt_method(lazy_strings_class, lazyStringsElt);
+  R_set_altstring_Set_elt_method(lazy_strings_class, lazyStringsSetElt);
+#endif
+}
+
+// data.frame of parsed tokens (see lazyStrings.h).
+DataFrame tokenDataFrame(std::vector< std::vector < std::string > >& results,
+                         const std::vector< std::vector < int > >& ids,
+                         const std::vector<std::string>& fields,
+                         const std::vector< std::vector < int > >* spans,
+                         const std::vector< std::vector < int > >* parents,
+                         const std::vector< std::vector < int > >* eojeols) {
+  const size_t n_fields = fields.size();
+  const size_t stride = 1 + n_fields;
+
+  std::vector<int> doc_id;
+  std::vector<int> sentence_id;
+  std::vector<int> token_id;
+  std::vector<int> start;
+  std::vector<int> end;
+  std::vector<int> parent_id;
+  std::vector<int> eojeol_id;
+
+  // token and feature columns stay in C++ until R reads them
+  std::shared_ptr<StringArena> arena = std::make_shared<StringArena>();
+  arena->columns.resize(stride);
+
+  size_t n_tokens = 0;
+  for (size_t k = 0; k < results.size(); ++k) {
+    n_tokens += results[k].size() / stride;
+  }
+  doc_id.reserve(n_tokens);
+  sentence_id.reserve(n_tokens);
+  token_id.reserve(n_tokens);
+  if (spans) {
+    start.reserve(n_tokens);
+    end.reserve(n_tokens);
+  }
+  if (parents) {
+    parent_id.reserve(n_tokens);
+  }
+  if (eojeols) {
+    eojeol_id.reserve(n_tokens);
+  }
+  for (size_t c = 0; c < stride; ++c) {
+    arena->columns[c].reserve(n_tokens);
+  }
+
+  // explicit type conversion
+  for (size_t k = 0; k < results.size(); ++k) {
+    for (size_t l = 0, t = 0; l + stride <= results[k].size(); l += stride, ++t) {
+      for (size_t c = 0; c < stride; ++c) {
+        arena->columns[c].push_back(std::move(results[k][l + c]));
+      }
+
+      // append sentence_id and token_id numbered by the workers
+      sentence_id.push_back(ids[k][2 * t]);
+      token_id.push_back(ids[k][2 * t + 1]);
+      if (spans) {
+        start.push_back((*spans)[k][2 * t]);
+        end.push_back((*spans)[k][2 * t + 1]);
+      }
+      if (parents) {
+        parent_id.push_back((*parents)[k][t]);
+      }
+      if (eojeols) {
+        eojeol_id.push_back((*eojeols)[k][t]);
+      }
+
+      // append doc_id
+      doc_id.push_back(static_cast<int>(k + 1));
+    }
+    std::vector< std::string >().swap(results[k]);
+  }
+
+  List columns = List::create(
+    _["doc_id"] = wrap(doc_id),
+    _["sentence_id"] = wrap(sentence_id),
+    _["token_id"] = wrap(token_id),
+    _["token"] = makeLazyStringColumn(arena, 0, true)
+  );
+  if (spans) {
+    columns.push_back(wrap(start), "start");
+    columns.push_back(wrap(end), "end");
+  }
+  if (parents) {
+    columns.push_back(wrap(parent_id), "parent_id");
+  }
+  if (eojeols) {
+    columns.push_back(wrap(eojeol_id), "eojeol_id");
+  }
+  for (size_t f = 0; f < n_fields; ++f) {
+    columns.push_back(makeLazyStringColumn(arena, 1 + f, true), fields[f]);
+  }
+
+  return makeDataFrame(columns, n_tokens);
+}
@@ -0,0 +1,34 @@
+#ifndef RCPPMECAB_LAZYSTRINGS_H
+#define RCPPMECAB_LAZYSTRINGS_H
+
+#include <Rcpp.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Parsed string columns shared by the lazy character vectors made from them.
+// The arena is freed when the last of those vectors is garbage collected.
+struct StringArena
+{
+  std::vector< std::vector<std::string> > columns;
+};
+
+// Character vector over `arena->columns[column]`. On R >= 3.5.0 this is an
+// ALTREP vector that makes a CHARSXP only when an element is accessed;
+// otherwise the column is copied at once. With `star_na`, "*" becomes NA as
+// `dplyr::na_if(x, "*")` did for the data.frame outputs.
+SEXP makeLazyStringColumn(const std::shared_ptr<StringArena>& arena, size_t column, bool star_na);
+
+// data.frame of parsed tokens: `results[k]` holds the token and `fields` of
+// each token of document k, `ids[k]` its sentence_id and token_id pairs. The
+// strings are moved into the arena behind the lazy character columns;
+// `spans`, `parents` and `eojeols` add the offset, parent_id and eojeol_id
+// columns when given. Shared by pos() and posParallel().
+Rcpp::DataFrame tokenDataFrame(std::vector< std::vector < std::string > >& results,
+                               const std::vector< std::vector < int > >& ids,
+                               const std::vector<std::string>& fields,
+                               const std::vector< std::vector < int > >* spans = NULL,
+                               const std::vector< std::vector < int > >* parents = NULL,
+                               const std::vector< std::vector < int > >* eojeols = NULL);
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef RCPPMECAB_MECABMODEL_H
+#define RCPPMECAB_MECABMODEL_H
+
+#include <Rcpp.h>
+#include <string>
+#include "../inst/include/mecab.h"
+
+// Model of a system and a user dictionary; an empty string keeps the one of
+// mecabrc. `options` are appended to the arguments, e.g. " -m". Reports on
+// Rcerr and returns NULL if MeCab cannot load the dictionaries.
+inline mecab_model_t* newModel(const std::string& sys_dic, const std::string& user_dic, const std::string& options = "") {
+  std::string args = "";
+  if (sys_dic != "") {
+    args.append(" -d ");
+    args.append(sys_dic);
+  }
+  if (user_dic != "") {
+    args.append(" -u ");
+    args.append(user_dic);
+  }
+  args.append(options);
+
+  mecab_model_t* model = mecab_model_new2(args.c_str());
+  if (!model) {
+    Rcpp::Rcerr << "model is NULL" << std::endl;
+  }
+  return model;
+}
+
+#endif
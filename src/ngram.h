@@ -0,0 +1,78 @@
+#ifndef RCPPMECAB_NGRAM_H
+#define RCPPMECAB_NGRAM_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+// Collects n-grams of the units of one sentence at a time, so n-grams never
+// cross sentence or document boundaries. In count mode identical n-grams of
+// a document are merged and `values` holds their counts; otherwise `values`
+// holds the sentence id of each n-gram.
+class NgramCollector
+{
+public:
+  NgramCollector(size_t n_min, size_t n_max, const std::string& sep, bool count)
+    : n_min_(n_min), n_max_(n_max), sep_(sep), count_(count)
+  {}
+
+  void add(const std::string& unit) {
+    units_.push_back(unit);
+  }
+
+  void endSentence(int sentence_id) {
+    for (size_t n = n_min_; n <= n_max_ && n <= units_.size(); ++n) {
+      for (size_t i = 0; i + n <= units_.size(); ++i) {
+        gram_.assign(units_[i]);
+        for (size_t j = 1; j < n; ++j) {
+          gram_.append(sep_);
+          gram_.append(units_[i + j]);
+        }
+        emit(sentence_id);
+      }
+    }
+    units_.clear();
+  }
+
+  // Hand over the n-grams of the current document and reset the collector.
+  void finish(std::vector<std::string>& grams, std::vector<int>& values) {
+    grams.swap(grams_);
+    values.swap(values_);
+    grams_.clear();
+    values_.clear();
+    index_.clear();
+    units_.clear();
+  }
+
+private:
+
+  void emit(int sentence_id) {
+    if (!count_) {
+      grams_.push_back(gram_);
+      values_.push_back(sentence_id);
+      return;
+    }
+
+    std::unordered_map<std::string, size_t>::iterator it = index_.find(gram_);
+    if (it == index_.end()) {
+      index_.insert(std::make_pair(gram_, grams_.size()));
+      grams_.push_back(gram_);
+      values_.push_back(1);
+    } else {
+      values_[it->second]++;
+    }
+  }
+
+  size_t n_min_;
+  size_t n_max_;
+  std::string sep_;
+  bool count_;
+
+  std::vector<std::string> units_;
+  std::string gram_;
+  std::vector<std::string> grams_;
+  std::vector<int> values_;
+  std::unordered_map<std::string, size_t> index_;
+};
+
+#endif
@@ -0,0 +1,77 @@
+// [[Rcpp::plugins(cpp11)]]
+
+#define R_NO_REMAP
+
+#include <Rcpp.h>
+#include <string>
+#include <vector>
+#include "stringColumn.h"
+
+using namespace Rcpp;
+
+//' Pack tokens into one string per document in a single pass.
+//'
+//' @param doc_id Integer vector. Rows of a document should be contiguous.
+//' @param token Character vector.
+//' @param collapse String scalar.
+//' @return list of `start` rows and packed `text`.
+//'
+//' @name packRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+List packRcpp(IntegerVector doc_id, StringVector token, std::string collapse) {
+
+  if (doc_id.size() != token.size()) {
+    stop("doc_id and token should have the same length.");
+  }
+
+  const R_xlen_t n = token.size();
+
+  std::vector<int> start;
+  std::vector<std::string> text;
+  std::vector<bool> missing;
+
+  std::string packed;
+  bool has_na = false;
+
+  for (R_xlen_t i = 0; i < n; ++i) {
+    if (i > 0 && doc_id[i] != doc_id[i - 1]) {
+      text.push_back(packed);
+      missing.push_back(has_na);
+      packed.clear();
+      has_na = false;
+    }
+    if (i == 0 || doc_id[i] != doc_id[i - 1]) {
+      start.push_back(static_cast<int>(i + 1));
+    } else {
+      packed.append(collapse);
+    }
+
+    SEXP elem = STRING_ELT(token, i);
+    if (elem == NA_STRING) {
+      // same as `stringr::str_c()`: NA makes the whole document NA
+      has_na = true;
+    } else {
+      packed.append(Rf_translateCharUTF8(elem));
+    }
+  }
+  if (n > 0) {
+    text.push_back(packed);
+    missing.push_back(has_na);
+  }
+
+  StringVector result_text = makeStringColumn(text);
+  for (size_t k = 0; k < missing.size(); ++k) {
+    if (missing[k]) {
+      SET_STRING_ELT(result_text, k, NA_STRING);
+    }
+  }
+
+  return List::create(
+    _["start"] = wrap(start),
+    _["text"] = result_text
+  );
+}
@@ -0,0 +1,385 @@
+#ifndef RCPPMECAB_PARSEKERNEL_H
+#define RCPPMECAB_PARSEKERNEL_H
+
+#include <Rcpp.h>
+#include <RcppParallel.h>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../inst/include/mecab.h"
+#include "tokenFilter.h"
+#include "textNormalizer.h"
+#include "tokenOffset.h"
+#include "dicSchema.h"
+#include "koExpression.h"
+#include "posTable.h"
+#include "featureCache.h"
+
+// One node loop shared by every output format, serial or parallel. What a
+// document makes of its tokens is left to a policy:
+//
+//   start(i)                    before document i is parsed
+//   normalizeMap()              map to fill when the text is normalized, or NULL
+//   begin(lattice, text, map)   after parsing, before the first token
+//   token(node)                 for each token accepted by the filter
+//   skip(node)                  for each token rejected by the filter
+//   end()                       at the end of the document
+//   finish(i)                   after document i
+//
+// Policies are resolved at compile time, so each format gets its own loop
+// without virtual calls or std::function per token. Each thread gets one copy
+// of the policy for the life of the kernel and its copies, shared by all the
+// ranges the thread runs, so a policy may keep caches of one thread.
+struct TokenPolicy
+{
+  NormalizeMap* normalizeMap() { return NULL; }
+  void begin(mecab_lattice_t*, const std::string&, const NormalizeMap*) {}
+  void skip(const mecab_node_t*) {}
+  void end() {}
+  void finish(size_t) {}
+};
+
+template <typename Policy>
+class ParseKernel
+{
+public:
+  ParseKernel(const std::vector<std::string>* sentences, mecab_model_t* model, const TokenFilter& filter,
+              const Policy& policy, TextNormalizer normalizer = TextNormalizer())
+    : sentences_(sentences), model_(model), filter_(filter),
+      policies_(std::make_shared< tbb::enumerable_thread_specific<Policy> >(policy)), normalizer_(normalizer)
+  {}
+
+  // body of `tbb::parallel_for`; the serial functions pass the whole range
+  template <typename Range>
+  void operator()(const Range& range) const
+  {
+    run(range.begin(), range.end());
+  }
+
+  void run(size_t first, size_t last) const
+  {
+    mecab_t* tagger = mecab_model_new_tagger(model_);
+    mecab_lattice_t* lattice = mecab_model_new_lattice(model_);
+    const mecab_node_t* node;
+    TokenFilter::State filter_state;
+    std::string normalized;
+    Policy& policy = policies_->local();
+
+    for (size_t i = first; i < last; ++i) {
+      const std::string& text = (*sentences_)[i];
+
+      policy.start(i);
+      NormalizeMap* map = normalizer_.active() ? policy.normalizeMap() : NULL;
+      setLatticeSentence(lattice, text, normalizer_, normalized, map);
+      mecab_parse_lattice(tagger, lattice);
+      policy.begin(lattice, text, map);
+
+      node = mecab_lattice_get_bos_node(lattice);
+
+      for (; node; node = node->next) {
+        if (node->stat == MECAB_BOS_NODE)
+          ;
+        else if (node->stat == MECAB_EOS_NODE)
+          policy.end();
+        else if (!filter_.accept(node, filter_state))
+          policy.skip(node);
+        else
+          policy.token(node);
+      }
+
+      policy.finish(i); // mutex is not needed
+    }
+
+    mecab_lattice_destroy(lattice);
+    mecab_destroy(tagger);
+  }
+
+private:
+  const std::vector<std::string>* sentences_;
+  mecab_model_t* model_;
+  const TokenFilter& filter_;
+  // `tbb::parallel_for` copies its body, so the copies share the policies
+  std::shared_ptr< tbb::enumerable_thread_specific<Policy> > policies_;
+  TextNormalizer normalizer_;
+};
+
+// "morpheme/tag" per token.
+class JoinPolicy : public TokenPolicy
+{
+public:
+  explicit JoinPolicy(std::vector< std::vector < std::string > >& result)
+    : result_(&result), parsed_(NULL)
+  {}
+
+  void start(size_t i) {
+    parsed_ = &(*result_)[i];
+    parsed_->clear();
+  }
+
+  void token(const mecab_node_t* node) {
+    parsed_->push_back(std::string(node->surface, node->length));
+    parsed_->back().push_back('/');
+    parsed_->back().append(pos_table_.pos(node));
+  }
+
+private:
+  std::vector< std::vector < std::string > >* result_;
+  std::vector< std::string >* parsed_;
+  PosTable pos_table_;
+};
+
+// morpheme and tag, one after the other, per token.
+class TaggedPolicy : public TokenPolicy
+{
+public:
+  explicit TaggedPolicy(std::vector< std::vector < std::string > >& result)
+    : result_(&result), parsed_(NULL)
+  {}
+
+  void start(size_t i) {
+    parsed_ = &(*result_)[i];
+    parsed_->clear();
+  }
+
+  void token(const mecab_node_t* node) {
+    parsed_->push_back(std::string(node->surface, node->length));
+    parsed_->push_back(pos_table_.pos(node));
+  }
+
+private:
+  std::vector< std::vector < std::string > >* result_;
+  std::vector< std::string >* parsed_;
+  PosTable pos_table_;
+};
+
+// Surfaces of a document back to back in one buffer, with the end of each,
+// and the same for their POS when tagged.
+struct WakatiDoc
+{
+  std::string surfaces;
+  std::vector<int> ends;
+  std::string tags;
+  std::vector<int> tag_ends;
+};
+
+// Surfaces only; `node->feature` is never read unless tagged or a POS
+// filter asks for it.
+template <bool Tagged>
+class SurfacePolicy : public TokenPolicy
+{
+public:
+  explicit SurfacePolicy(std::vector< WakatiDoc >& result)
+    : result_(&result), doc_(NULL)
+  {}
+
+  void start(size_t i) {
+    doc_ = &(*result_)[i];
+  }
+
+  void begin(mecab_lattice_t*, const std::string& text, const NormalizeMap*) {
+    doc_->surfaces.reserve(text.size());
+  }
+
+  void token(const mecab_node_t* node) {
+    doc_->surfaces.append(node->surface, node->length);
+    doc_->ends.push_back(static_cast<int>(doc_->surfaces.size()));
+    if (Tagged) {
+      doc_->tags.append(pos_table_.pos(node));
+      doc_->tag_ends.push_back(static_cast<int>(doc_->tags.size()));
+    }
+  }
+
+private:
+  std::vector< WakatiDoc >* result_;
+  WakatiDoc* doc_;
+  PosTable pos_table_;
+};
+
+// Token and feature strings of every token, plus
+// (sentence_id, token_id) pairs, and optionally offsets, parent ids and
+// eojeol ids. A new eojeol starts at each token MeCab found whitespace
+// before (`rlength` > `length`), so they need no pass over the text.
+class DataFramePolicy : public TokenPolicy
+{
+public:
+  DataFramePolicy(std::vector< std::vector < std::string > >& result, std::vector< std::vector < int > >& ids, const DicSchema& schema,
+                  std::vector< std::vector < int > >* spans = NULL, TokenOffset::Mode offset_mode = TokenOffset::NONE,
+                  std::vector< std::vector < int > >* parents = NULL, std::vector< std::vector < int > >* eojeols = NULL)
+    : result_(&result), ids_(&ids), schema_(&schema), spans_(spans), parents_(parents), eojeols_(eojeols),
+      token_offset_(spans ? offset_mode : TokenOffset::NONE),
+      expand_(parents && schema.name == "mecab-ko-dic"),
+      parsed_(NULL), parsed_ids_(NULL), parsed_spans_(NULL), parsed_parents_(NULL), parsed_eojeols_(NULL),
+      sentence_number_(1), token_number_(1), eojeol_number_(0)
+  {}
+
+  void start(size_t i) {
+    parsed_ = &(*result_)[i];
+    parsed_ids_ = &(*ids_)[i];
+    parsed_->clear();
+    parsed_ids_->clear();
+    if (spans_) {
+      parsed_spans_ = &(*spans_)[i];
+      parsed_spans_->clear();
+    }
+    if (parents_) {
+      parsed_parents_ = &(*parents_)[i];
+      parsed_parents_->clear();
+    }
+    if (eojeols_) {
+      parsed_eojeols_ = &(*eojeols_)[i];
+      parsed_eojeols_->clear();
+    }
+    sentence_number_ = 1;
+    token_number_ = 1;
+    eojeol_number_ = 0;
+  }
+
+  NormalizeMap* normalizeMap() {
+    return token_offset_.active() ? &normalize_map_ : NULL;
+  }
+
+  void begin(mecab_lattice_t* lattice, const std::string& text, const NormalizeMap* map) {
+    if (map) {
+      token_offset_.reset(lattice, &text, map);
+    } else {
+      token_offset_.reset(lattice);
+    }
+    const size_t len = mecab_lattice_get_size(lattice);
+    parsed_->reserve(len * (1 + schema_->fields.size()));
+    parsed_ids_->reserve(len * 2);
+  }
+
+  void token(const mecab_node_t* node) {
+    countEojeol(node);
+
+    int start = 0, end = 0;
+    if (token_offset_.active()) {
+      token_offset_.locate(node, start, end);
+    }
+
+    const std::vector<FieldSpan>& spans = feature_cache_.spans(node);
+    if (expand_) {
+      feature_cache_.fields(node, features_);
+    }
+
+    if (expand_ && splitKoExpression(features_, morphemes_)) {
+      // component rows share the place of their parent token
+      for (size_t m = 0; m < morphemes_.size(); ++m) {
+        parsed_->push_back(morphemes_[m].surface);
+        for (size_t f = 0; f < schema_->columns.size(); ++f) {
+          parsed_->push_back(koMorphemeField(schema_->columns[f], morphemes_[m], features_[4]));
+        }
+        addRow(start, end, token_number_);
+      }
+    } else {
+      parsed_->push_back(std::string(node->surface, node->length));
+      for (size_t f = 0; f < schema_->fields.size(); ++f) {
+        // unknown words have a shorter feature
+        if (schema_->fields[f] < spans.size()) {
+          const FieldSpan& span = spans[schema_->fields[f]];
+          parsed_->push_back(std::string(node->feature + span.begin, span.length));
+        } else {
+          parsed_->push_back("*");
+        }
+      }
+      addRow(start, end, NA_INTEGER);
+    }
+
+    advance(node);
+  }
+
+  // rejected tokens keep their place in the numbering
+  void skip(const mecab_node_t* node) {
+    countEojeol(node);
+    advance(node);
+  }
+
+private:
+  void countEojeol(const mecab_node_t* node) {
+    if (node->rlength > node->length || eojeol_number_ == 0) {
+      eojeol_number_++;
+    }
+  }
+
+  void advance(const mecab_node_t* node) {
+    token_number_++;
+    if (isSentenceEnd(node)) {
+      sentence_number_++;
+      token_number_ = 1;
+    }
+  }
+
+  void addRow(int start, int end, int parent) {
+    parsed_ids_->push_back(sentence_number_);
+    parsed_ids_->push_back(token_number_);
+    if (parsed_parents_) {
+      parsed_parents_->push_back(parent);
+    }
+    if (parsed_eojeols_) {
+      parsed_eojeols_->push_back(eojeol_number_);
+    }
+    if (token_offset_.active()) {
+      parsed_spans_->push_back(start);
+      parsed_spans_->push_back(end);
+    }
+  }
+
+  std::vector< std::vector < std::string > >* result_;
+  std::vector< std::vector < int > >* ids_;
+  const DicSchema* schema_;
+  std::vector< std::vector < int > >* spans_;
+  std::vector< std::vector < int > >* parents_;
+  std::vector< std::vector < int > >* eojeols_;
+  TokenOffset token_offset_;
+  NormalizeMap normalize_map_;
+  bool expand_;
+  FeatureCache feature_cache_;
+  std::vector<std::string> features_;
+  std::vector<KoMorpheme> morphemes_;
+  std::vector< std::string >* parsed_;
+  std::vector< int >* parsed_ids_;
+  std::vector< int >* parsed_spans_;
+  std::vector< int >* parsed_parents_;
+  std::vector< int >* parsed_eojeols_;
+  int sentence_number_;
+  int token_number_;
+  int eojeol_number_;
+};
+
+struct TextParseJoin : public ParseKernel<JoinPolicy>
+{
+  TextParseJoin(const std::vector<std::string>* sentences, std::vector< std::vector < std::string > >& result, mecab_model_t* model, const TokenFilter& filter,
+                TextNormalizer normalizer = TextNormalizer())
+    : ParseKernel<JoinPolicy>(sentences, model, filter, JoinPolicy(result), normalizer)
+  {}
+};
+
+struct TextParse : public ParseKernel<TaggedPolicy>
+{
+  TextParse(const std::vector<std::string>* sentences, std::vector< std::vector < std::string > >& result, mecab_model_t* model, const TokenFilter& filter,
+            TextNormalizer normalizer = TextNormalizer())
+    : ParseKernel<TaggedPolicy>(sentences, model, filter, TaggedPolicy(result), normalizer)
+  {}
+};
+
+template <bool Tagged>
+struct TextParseWakati : public ParseKernel< SurfacePolicy<Tagged> >
+{
+  TextParseWakati(const std::vector<std::string>* sentences, std::vector< WakatiDoc >& result, mecab_model_t* model, const TokenFilter& filter,
+                  TextNormalizer normalizer = TextNormalizer())
+    : ParseKernel< SurfacePolicy<Tagged> >(sentences, model, filter, SurfacePolicy<Tagged>(result), normalizer)
+  {}
+};
+
+struct TextParseDF : public ParseKernel<DataFramePolicy>
+{
+  TextParseDF(const std::vector<std::string>* sentences, std::vector< std::vector < std::string > >& result, std::vector< std::vector < int > >& ids, mecab_model_t* model, const TokenFilter& filter, const DicSchema& schema,
+              std::vector< std::vector < int > >* spans = NULL, TokenOffset::Mode offset_mode = TokenOffset::NONE,
+              std::vector< std::vector < int > >* parents = NULL, std::vector< std::vector < int > >* eojeols = NULL,
+              TextNormalizer normalizer = TextNormalizer())
+    : ParseKernel<DataFramePolicy>(sentences, model, filter, DataFramePolicy(result, ids, schema, spans, offset_mode, parents, eojeols), normalizer)
+  {}
+};
+
+#endif
@@ -7,163 +7,241 @@
 #include <Rcpp.h>
 #include <RcppThread.h>
 #include <RcppParallel.h>
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <thread>
+#include <unordered_map>
 #include <boost/algorithm/string.hpp>
 #include "../inst/include/mecab.h"
+#include "tokenFilter.h"
+#include "dicSchema.h"
+#include "stringColumn.h"
+#include "ngram.h"
+#include "tokenStore.h"
+#include "lazyStrings.h"
+#include "arrowExport.h"
+#include "tokenOffset.h"
+#include "koExpression.h"
+#include "utf8Input.h"
+#include "textNormalizer.h"
+#include "tokenServer.h"
+#include "asyncJob.h"
+#include "vocabulary.h"
+#include "parseKernel.h"
+#include "mecabModel.h"
 
 using namespace Rcpp;
 
-struct TextParseJoin
+// N-grams of the tokens of each sentence, as strings or counts.
+class NgramPolicy : public TokenPolicy
 {
-  TextParseJoin(const std::vector<std::string>* sentences, std::vector< std::vector < std::string > >& result, mecab_model_t* model)
-    : sentences_(sentences), result_(result), model_(model)
+public:
+  NgramPolicy(std::vector< std::vector < std::string > >& result, std::vector< std::vector < int > >& values,
+              size_t n_min, size_t n_max, const std::string& sep, bool tag, bool count)
+    : result_(&result), values_(&values), collector_(n_min, n_max, sep, count), tag_(tag), sentence_number_(1)
   {}
 
-  void operator()(const tbb::blocked_range<size_t>& range) const
-  {
-    mecab_t* tagger = mecab_model_new_tagger(model_);
-    mecab_lattice_t* lattice = mecab_model_new_lattice(model_);
-    const mecab_node_t* node;
-
-    for (size_t i = range.begin(); i < range.end(); ++i) {
-      std::vector< std::string > parsed;
-
-      mecab_lattice_set_sentence(lattice, (*sentences_)[i].c_str());
-      mecab_parse_lattice(tagger, lattice);
+  void start(size_t) {
+    sentence_number_ = 1;
+  }
 
-      const size_t len = mecab_lattice_get_size(lattice);
-      parsed.reserve(len);
-
-      node = mecab_lattice_get_bos_node(lattice);
-
-      for (; node; node = node->next) {
-        if (node->stat == MECAB_BOS_NODE)
-          ;
-        else if (node->stat == MECAB_EOS_NODE)
-          ;
-        else {
-          std::string parsed_morph = std::string(node->surface).substr(0, node->length);
-          std::vector<std::string> features;
-          boost::split(features, node->feature, boost::is_any_of(","));
-          parsed.push_back(parsed_morph + "/" + features[0]);
-        }
-      }
+  void token(const mecab_node_t* node) {
+    unit_.assign(node->surface, node->length);
+    if (tag_) {
+      unit_.push_back('/');
+      unit_.append(pos_table_.pos(node));
+    }
+    collector_.add(unit_);
+    skip(node);
+  }
 
-      result_[i] = parsed; // mutex is not needed
+  // n-grams do not cross sentence boundaries
+  void skip(const mecab_node_t* node) {
+    if (isSentenceEnd(node)) {
+      collector_.endSentence(sentence_number_);
+      sentence_number_++;
     }
+  }
 
-    mecab_lattice_destroy(lattice);
-    mecab_destroy(tagger);
+  void end() {
+    collector_.endSentence(sentence_number_);
   }
 
-  const std::vector<std::string>* sentences_;
-  std::vector< std::vector < std::string > >& result_;
-  mecab_model_t* model_;
+  void finish(size_t i) {
+    collector_.finish((*result_)[i], (*values_)[i]);
+  }
+
+private:
+  std::vector< std::vector < std::string > >* result_;
+  std::vector< std::vector < int > >* values_;
+  NgramCollector collector_;
+  bool tag_;
+  int sentence_number_;
+  std::string unit_;
+  PosTable pos_table_;
 };
 
-struct TextParseDF
+struct TextParseNgram : public ParseKernel<NgramPolicy>
 {
-  TextParseDF(const std::vector<std::string>* sentences, std::vector< std::vector < std::string > >& result, mecab_model_t* model)
-    : sentences_(sentences), result_(result), model_(model)
+  TextParseNgram(const std::vector<std::string>* sentences, std::vector< std::vector < std::string > >& result, std::vector< std::vector < int > >& values, mecab_model_t* model, const TokenFilter& filter, size_t n_min, size_t n_max, const std::string& sep, bool tag, bool count,
+                 TextNormalizer normalizer = TextNormalizer())
+    : ParseKernel<NgramPolicy>(sentences, model, filter, NgramPolicy(result, values, n_min, n_max, sep, tag, count), normalizer)
   {}
+};
 
-  void operator()(const tbb::blocked_range<size_t>& range) const
-  {
-    mecab_t* tagger = mecab_model_new_tagger(model_);
-    mecab_lattice_t* lattice = mecab_model_new_lattice(model_);
-    const mecab_node_t* node;
-
-    for (size_t i = range.begin(); i < range.end(); ++i) {
-      std::vector< std::string > parsed;
+// Morphemes of each document joined by `collapse`.
+class PackPolicy : public TokenPolicy
+{
+public:
+  PackPolicy(std::vector< std::string >& result, const std::string& collapse)
+    : result_(&result), collapse_(collapse), packed_(NULL), first_(true)
+  {}
 
-      mecab_lattice_set_sentence(lattice, (*sentences_)[i].c_str());
-      mecab_parse_lattice(tagger, lattice);
+  void start(size_t i) {
+    packed_ = &(*result_)[i];
+    packed_->clear();
+    first_ = true;
+  }
 
-      const size_t len = mecab_lattice_get_size(lattice);
-      parsed.reserve(len*4);
-
-      node = mecab_lattice_get_bos_node(lattice);
-
-      for (; node; node = node->next) {
-        if (node->stat == MECAB_BOS_NODE)
-          ;
-        else if (node->stat == MECAB_EOS_NODE)
-          ;
-        else {
-          std::string parsed_morph = std::string(node->surface).substr(0, node->length);
-          std::vector<std::string> features;
-          boost::split(features, node->feature, boost::is_any_of(","));
-          parsed.push_back(parsed_morph);
-          parsed.push_back(features[0]);
-          parsed.push_back(features[1]);
-          // For parsing unk-feature when using Japanese MeCab and IPA-dict.
-          if (features.size() > 7) {
-            parsed.push_back(features[7]);
-          } else {
-            parsed.push_back("*");
-          }
-        }
-      }
+  void begin(mecab_lattice_t*, const std::string& text, const NormalizeMap*) {
+    packed_->reserve(text.size() * 2);
+  }
 
-      result_[i] = parsed; // mutex is not needed
+  void token(const mecab_node_t* node) {
+    if (!first_) {
+      packed_->append(collapse_);
     }
+    packed_->append(node->surface, node->length);
+    first_ = false;
+  }
 
-    mecab_lattice_destroy(lattice);
-    mecab_destroy(tagger);
+private:
+  std::vector< std::string >* result_;
+  std::string collapse_;
+  std::string* packed_;
+  bool first_;
+};
+
+struct TextParsePack : public ParseKernel<PackPolicy>
+{
+  TextParsePack(const std::vector<std::string>* sentences, std::vector< std::string >& result, mecab_model_t* model, const TokenFilter& filter, const std::string& collapse,
+                TextNormalizer normalizer = TextNormalizer())
+    : ParseKernel<PackPolicy>(sentences, model, filter, PackPolicy(result, collapse), normalizer)
+  {}
+};
+
+// Codes of the morphemes, or "morpheme/tag", in a vocabulary shared by the
+// workers. Codes already seen by this worker are cached, so the shards are
+// locked once per type.
+template <bool Tagged>
+class IdsPolicy : public TokenPolicy
+{
+public:
+  IdsPolicy(std::vector< std::vector < boost::uint32_t > >& result, ShardedVocabulary& vocabulary)
+    : result_(&result), vocabulary_(&vocabulary), codes_(NULL)
+  {}
+
+  void start(size_t i) {
+    codes_ = &(*result_)[i];
   }
 
-  const std::vector<std::string>* sentences_;
-  std::vector< std::vector < std::string > >& result_;
-  mecab_model_t* model_;
+  void token(const mecab_node_t* node) {
+    key_.assign(node->surface, node->length);
+    if (Tagged) {
+      key_.push_back('/');
+      key_.append(pos_table_.pos(node));
+    }
+    std::unordered_map<std::string, boost::uint32_t>::iterator it = seen_.find(key_);
+    if (it == seen_.end()) {
+      it = seen_.insert(std::make_pair(key_, vocabulary_->code(key_))).first;
+    }
+    codes_->push_back(it->second);
+  }
+
+private:
+  std::vector< std::vector < boost::uint32_t > >* result_;
+  ShardedVocabulary* vocabulary_;
+  std::vector< boost::uint32_t >* codes_;
+  std::unordered_map<std::string, boost::uint32_t> seen_;
+  std::string key_;
+  PosTable pos_table_;
 };
 
-struct TextParse
+template <bool Tagged>
+struct TextParseIds : public ParseKernel< IdsPolicy<Tagged> >
 {
-  TextParse(const std::vector<std::string>* sentences, std::vector< std::vector < std::string > >& result, mecab_model_t* model)
-    : sentences_(sentences), result_(result), model_(model)
+  TextParseIds(const std::vector<std::string>* sentences, std::vector< std::vector < boost::uint32_t > >& result, mecab_model_t* model, const TokenFilter& filter,
+               ShardedVocabulary& vocabulary, TextNormalizer normalizer = TextNormalizer())
+    : ParseKernel< IdsPolicy<Tagged> >(sentences, model, filter, IdsPolicy<Tagged>(result, vocabulary), normalizer)
   {}
+};
 
-  void operator()(const tbb::blocked_range<size_t>& range) const
-  {
-    mecab_t* tagger = mecab_model_new_tagger(model_);
-    mecab_lattice_t* lattice = mecab_model_new_lattice(model_);
-    const mecab_node_t* node;
+// Per-document counters: tokens, unknown words, characters and the tokens of
+// each POS, kept as (POS, count) pairs since a document has only a few.
+struct DocStats
+{
+  DocStats() : tokens(0), unknown(0), chars(0) {}
 
-    for (size_t i = range.begin(); i < range.end(); ++i) {
-      std::vector< std::string > parsed;
+  int tokens;
+  int unknown;
+  int chars;
+  std::vector< std::pair<std::string, int> > pos;
+};
 
-      mecab_lattice_set_sentence(lattice, (*sentences_)[i].c_str());
-      mecab_parse_lattice(tagger, lattice);
+// POS of a worker are counted densely by their index in its PosTable.
+class StatsPolicy : public TokenPolicy
+{
+public:
+  explicit StatsPolicy(std::vector< DocStats >& result)
+    : result_(&result), stats_(NULL)
+  {}
 
-      const size_t len = mecab_lattice_get_size(lattice);
-      parsed.reserve(len*2);
-
-      node = mecab_lattice_get_bos_node(lattice);
-
-      for (; node; node = node->next) {
-        if (node->stat == MECAB_BOS_NODE)
-          ;
-        else if (node->stat == MECAB_EOS_NODE)
-          ;
-        else {
-          std::string parsed_morph = std::string(node->surface).substr(0, node->length);
-          // add join mechanism
-          std::vector<std::string> features;
-          boost::split(features, node->feature, boost::is_any_of(","));
-          parsed.push_back(parsed_morph);
-          parsed.push_back(features[0]);
-        }
+  void start(size_t i) {
+    stats_ = &(*result_)[i];
+    counts_.assign(pos_table_.size(), 0);
+  }
+
+  void token(const mecab_node_t* node) {
+    stats_->tokens++;
+    if (node->stat == MECAB_UNK_NODE) {
+      stats_->unknown++;
+    }
+    for (size_t b = 0; b < node->length; ++b) {
+      if ((static_cast<unsigned char>(node->surface[b]) & 0xC0) != 0x80) {
+        stats_->chars++;
       }
+    }
 
-      result_[i] = parsed; // mutex is not needed
+    const size_t index = pos_table_.index(node);
+    if (index >= counts_.size()) {
+      counts_.resize(index + 1, 0);
     }
+    counts_[index]++;
+  }
 
-    mecab_lattice_destroy(lattice);
-    mecab_destroy(tagger);
+  void finish(size_t) {
+    for (size_t p = 0; p < counts_.size(); ++p) {
+      if (counts_[p] > 0) {
+        stats_->pos.push_back(std::make_pair(pos_table_.name(p), counts_[p]));
+      }
+    }
   }
 
-  const std::vector<std::string>* sentences_;
-  std::vector< std::vector < std::string > >& result_;
-  mecab_model_t* model_;
+private:
+  std::vector< DocStats >* result_;
+  DocStats* stats_;
+  PosTable pos_table_;
+  std::vector<int> counts_;
+};
+
+struct TextParseStats : public ParseKernel<StatsPolicy>
+{
+  TextParseStats(const std::vector<std::string>* sentences, std::vector< DocStats >& result, mecab_model_t* model, const TokenFilter& filter,
+                 TextNormalizer normalizer = TextNormalizer())
+    : ParseKernel<StatsPolicy>(sentences, model, filter, StatsPolicy(result), normalizer)
+  {}
 };
 
 //' Call POS Tagger via `tbb::parallel_for` and return a named list.
@@ -171,6 +249,8 @@ struct TextParse
 //' @param text Character vector.
 //' @param sys_dic String scalar.
 //' @param user_dic String scalar.
+//' @param filter List of token filter settings.
+//' @param normalize String scalar. "none", "width" or "neologd".
 //' @return named list.
 //'
 //' @name posParallelJoinRcpp
@@ -179,253 +259,1593 @@ struct TextParse
 //
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::export]]
-List posParallelJoinRcpp(std::vector<std::string> text, std::string sys_dic, std::string user_dic) {
+List posParallelJoinRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create(), std::string normalize = "none") {
 
-  std::vector< std::vector < std::string > > results(text.size());
-  List result;
+  Utf8Input utf8_input(text);
+  std::vector< std::string >& input = utf8_input.texts();
 
-  std::string args = "";
-  if (sys_dic != "") {
-    args.append(" -d ");
-    args.append(sys_dic);
-  }
-  if (user_dic != "") {
-    args.append(" -u ");
-    args.append(user_dic);
+  std::vector< std::vector < std::string > > results(input.size());
+
+  // create model
+  mecab_model_t* model = newModel(sys_dic, user_dic);
+  if (!model) {
+    return R_NilValue;
   }
 
-  // lattice model
-  mecab_model_t* model;
+  TokenFilter token_filter(filter);
+
+  // parallel argorithm with Intell TBB
+  // RcppParallel doesn't get CharacterVector as input and output
+  TextParseJoin func = TextParseJoin(&input, results, model, token_filter, TextNormalizer(TextNormalizer::parseMode(normalize)));
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, input.size()), func);
+
+  mecab_model_destroy(model);
+
+  utf8_input.warn();
+
+  return tokenList(results, false, text);
+}
+
+//' Call POS Tagger via `tbb::parallel_for` and return a data.frame
+//'
+//' @param text Character vector.
+//' @param sys_dic String scalar.
+//' @param user_dic String scalar.
+//' @param filter List of token filter settings.
+//' @param offset String scalar. "none", "byte" or "char".
+//' @param expand Logical. Expand mecab-ko-dic expressions into component rows.
+//' @param normalize String scalar. "none", "width" or "neologd".
+//' @param eojeol Logical. Add an `eojeol_id` column numbering whitespace-separated units.
+//' @return data.frame.
+//'
+//' @name posParallelDFRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+DataFrame posParallelDFRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create(), std::string offset = "none", bool expand = false, std::string normalize = "none", bool eojeol = false) {
+
+  Utf8Input utf8_input(text);
+  std::vector< std::string >& input = utf8_input.texts();
+
+  std::vector< std::vector < std::string > > results(input.size());
+  std::vector< std::vector < int > > ids(input.size());
+  std::vector< std::vector < int > > spans(input.size());
+  std::vector< std::vector < int > > parents(input.size());
+  std::vector< std::vector < int > > eojeols(input.size());
 
   // create model
-  model = mecab_model_new2(args.c_str());
+  mecab_model_t* model = newModel(sys_dic, user_dic);
   if (!model) {
-    Rcerr << "model is NULL" << std::endl;
     return R_NilValue;
   }
 
+  TokenFilter token_filter(filter);
+  const TokenOffset::Mode offset_mode = TokenOffset::parseMode(offset);
+
+  // feature columns depend on the system dictionary
+  const DicSchema schema = detectDicSchema(model);
+
   // parallel argorithm with Intell TBB
   // RcppParallel doesn't get CharacterVector as input and output
-  TextParseJoin func = TextParseJoin(&text, results, model);
-  tbb::parallel_for(tbb::blocked_range<size_t>(0, text.size()), func);
+  TextParseDF func = TextParseDF(&input, results, ids, model, token_filter, schema, &spans, offset_mode, expand ? &parents : NULL,
+                                 eojeol ? &eojeols : NULL, TextNormalizer(TextNormalizer::parseMode(normalize)));
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, input.size()), func);
 
   mecab_model_destroy(model);
 
-  // explicit type conversion
-  for (size_t k = 0; k < results.size(); ++k) {
-    CharacterVector resultString;
-    for (size_t l = 0; l < results[k].size(); ++l) {
-      String morph_copy; // type conversion to Rcpp::String and set encoding
-      morph_copy = results[k][l];
-      morph_copy.set_encoding(CE_UTF8);
-      resultString.push_back(morph_copy);
+  utf8_input.warn();
+
+  return tokenDataFrame(results, ids, schema.columns,
+                        offset_mode != TokenOffset::NONE ? &spans : NULL,
+                        expand ? &parents : NULL,
+                        eojeol ? &eojeols : NULL);
+}
+
+// Parses each range with every dictionary in the same worker, so the models
+// share the input and the scheduling of one `tbb::parallel_for`.
+struct TextParseMulti
+{
+  explicit TextParseMulti(const std::vector<TextParseDF>& parsers)
+    : parsers_(parsers)
+  {}
+
+  void operator()(const tbb::blocked_range<size_t>& range) const
+  {
+    for (size_t d = 0; d < parsers_.size(); ++d) {
+      parsers_[d](range);
     }
-    result.push_back(resultString);
   }
 
-  StringVector result_name(text.size());
+  const std::vector<TextParseDF>& parsers_;
+};
+
+//' Call POS Tagger with several dictionaries via `tbb::parallel_for` and return a data.frame
+//'
+//' @param text Character vector.
+//' @param sys_dic Character vector. One system dictionary per model.
+//' @param user_dic Character vector. One user dictionary per model, or a single one for all.
+//' @param filter List of token filter settings.
+//' @param offset String scalar. "none", "byte" or "char".
+//' @param expand Logical. Expand mecab-ko-dic expressions into component rows.
+//' @param normalize String scalar. "none", "width" or "neologd".
+//' @return data.frame with a `dic` column numbering the models.
+//'
+//' @name posParallelMultiDFRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+DataFrame posParallelMultiDFRcpp(StringVector text, std::vector<std::string> sys_dic, std::vector<std::string> user_dic, List filter = List::create(), std::string offset = "none", bool expand = false, std::string normalize = "none") {
 
-  for (size_t h = 0; h < text.size(); ++h) {
-    String character_name = text[h];
-    character_name.set_encoding(CE_UTF8);
-    result_name[h] = character_name;
+  if (sys_dic.empty()) {
+    stop("sys_dic should have at least one dictionary.");
+  }
+  if (user_dic.size() != 1 && user_dic.size() != sys_dic.size()) {
+    stop("user_dic should have one element or as many as sys_dic.");
   }
 
-  result.names() = result_name;
+  Utf8Input utf8_input(text);
+  std::vector< std::string >& input = utf8_input.texts();
 
-  return result;
+  const size_t n_dics = sys_dic.size();
+  const size_t n_docs = input.size();
+
+  // lattice models
+  std::vector<mecab_model_t*> models;
+  for (size_t d = 0; d < n_dics; ++d) {
+    // create model
+    mecab_model_t* model = newModel(sys_dic[d], user_dic.size() == 1 ? user_dic[0] : user_dic[d]);
+    if (!model) {
+      for (size_t m = 0; m < models.size(); ++m) {
+        mecab_model_destroy(models[m]);
+      }
+      return R_NilValue;
+    }
+    models.push_back(model);
+  }
+
+  TokenFilter token_filter(filter);
+  const TokenOffset::Mode offset_mode = TokenOffset::parseMode(offset);
+  const TextNormalizer normalizer(TextNormalizer::parseMode(normalize));
+
+  // feature columns are the union of the schemas, in order of appearance
+  std::vector<DicSchema> schemas;
+  std::vector<std::string> fields;
+  std::vector< std::vector<int> > field_index(n_dics);
+  for (size_t d = 0; d < n_dics; ++d) {
+    schemas.push_back(detectDicSchema(models[d]));
+    for (size_t f = 0; f < schemas[d].columns.size(); ++f) {
+      const std::string& column = schemas[d].columns[f];
+      const size_t u = std::find(fields.begin(), fields.end(), column) - fields.begin();
+      if (u == fields.size()) {
+        fields.push_back(column);
+      }
+      field_index[d].push_back(static_cast<int>(u));
+    }
+  }
+
+  std::vector< std::vector< std::vector < std::string > > > results(n_dics, std::vector< std::vector < std::string > >(n_docs));
+  std::vector< std::vector< std::vector < int > > > ids(n_dics, std::vector< std::vector < int > >(n_docs));
+  std::vector< std::vector< std::vector < int > > > spans(n_dics, std::vector< std::vector < int > >(n_docs));
+  std::vector< std::vector< std::vector < int > > > parents(n_dics, std::vector< std::vector < int > >(n_docs));
+
+  std::vector<TextParseDF> parsers;
+  for (size_t d = 0; d < n_dics; ++d) {
+    parsers.push_back(TextParseDF(&input, results[d], ids[d], models[d], token_filter, schemas[d],
+                                  &spans[d], offset_mode, expand ? &parents[d] : NULL, NULL, normalizer));
+  }
+
+  // parallel argorithm with Intell TBB
+  // RcppParallel doesn't get CharacterVector as input and output
+  TextParseMulti func = TextParseMulti(parsers);
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, n_docs), func);
+
+  for (size_t d = 0; d < n_dics; ++d) {
+    mecab_model_destroy(models[d]);
+  }
+
+  const size_t n_fields = fields.size();
+  size_t n_tokens = 0;
+  for (size_t d = 0; d < n_dics; ++d) {
+    const size_t stride = 1 + schemas[d].columns.size();
+    for (size_t k = 0; k < n_docs; ++k) {
+      n_tokens += results[d][k].size() / stride;
+    }
+  }
+
+  std::vector<int> doc_id;
+  std::vector<int> dic;
+  std::vector<int> sentence_id;
+  std::vector<int> token_id;
+  std::vector<int> start;
+  std::vector<int> end;
+  std::vector<int> parent_id;
+  doc_id.reserve(n_tokens);
+  dic.reserve(n_tokens);
+  sentence_id.reserve(n_tokens);
+  token_id.reserve(n_tokens);
+
+  std::shared_ptr<StringArena> arena = std::make_shared<StringArena>();
+  arena->columns.resize(1 + n_fields);
+  for (size_t c = 0; c < 1 + n_fields; ++c) {
+    arena->columns[c].reserve(n_tokens);
+  }
+
+  // rows of a document are kept together, one dictionary after another
+  for (size_t k = 0; k < n_docs; ++k) {
+    for (size_t d = 0; d < n_dics; ++d) {
+      const size_t stride = 1 + schemas[d].columns.size();
+      std::vector<std::string>& parsed = results[d][k];
+      for (size_t l = 0, t = 0; l + stride <= parsed.size(); l += stride, ++t) {
+        arena->columns[0].push_back(std::move(parsed[l]));
+        for (size_t u = 0; u < n_fields; ++u) {
+          arena->columns[1 + u].push_back("*");
+        }
+        for (size_t f = 0; f < field_index[d].size(); ++f) {
+          arena->columns[1 + field_index[d][f]].back() = std::move(parsed[l + 1 + f]);
+        }
+
+        doc_id.push_back(static_cast<int>(k + 1));
+        dic.push_back(static_cast<int>(d + 1));
+        sentence_id.push_back(ids[d][k][2 * t]);
+        token_id.push_back(ids[d][k][2 * t + 1]);
+        if (offset_mode != TokenOffset::NONE) {
+          start.push_back(spans[d][k][2 * t]);
+          end.push_back(spans[d][k][2 * t + 1]);
+        }
+        if (expand) {
+          parent_id.push_back(parents[d][k][t]);
+        }
+      }
+      std::vector< std::string >().swap(parsed);
+    }
+  }
+
+  List columns = List::create(
+    _["doc_id"] = wrap(doc_id),
+    _["dic"] = wrap(dic),
+    _["sentence_id"] = wrap(sentence_id),
+    _["token_id"] = wrap(token_id),
+    _["token"] = makeLazyStringColumn(arena, 0, true)
+  );
+  if (offset_mode != TokenOffset::NONE) {
+    columns.push_back(wrap(start), "start");
+    columns.push_back(wrap(end), "end");
+  }
+  if (expand) {
+    columns.push_back(wrap(parent_id), "parent_id");
+  }
+  for (size_t u = 0; u < n_fields; ++u) {
+    columns.push_back(makeLazyStringColumn(arena, 1 + u, true), fields[u]);
+  }
+
+  utf8_input.warn();
+
+  return makeDataFrame(columns, n_tokens);
 }
 
-//' Call POS Tagger via `tbb::parallel_for` and return a data.frame
+//' Call POS Tagger via `tbb::parallel_for` and return a list of named character vectors.
 //'
 //' @param text Character vector.
 //' @param sys_dic String scalar.
 //' @param user_dic String scalar.
-//' @return data.frame.
+//' @param filter List of token filter settings.
+//' @param normalize String scalar. "none", "width" or "neologd".
+//' @return list of named character vectors.
 //'
-//' @name posParallelDFRcpp
+//' @name posParallelRcpp
 //' @keywords internal
 //' @export
 //
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::export]]
-DataFrame posParallelDFRcpp(StringVector text, std::string sys_dic, std::string user_dic) {
+List posParallelRcpp( StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create(), std::string normalize = "none" ) {
 
-  std::vector< std::vector < std::string > > results(text.size());
-  std::vector< std::string > input = as<std::vector< std::string > >(text);
+  Utf8Input utf8_input(text);
+  std::vector< std::string >& input = utf8_input.texts();
 
-  IntegerVector doc_id;
-  IntegerVector sentence_id;
-  IntegerVector token_id;
-  StringVector token;
-  StringVector pos;
-  StringVector subtype;
-  StringVector analytic;
+  std::vector< std::vector < std::string > > results(input.size());
 
-  String token_t;
-  String pos_t;
-  String subtype_t;
-  String analytic_t;
+  // create model
+  mecab_model_t* model = newModel(sys_dic, user_dic);
+  if (!model) {
+    return R_NilValue;
+  }
 
-  int doc_number = 0;
-  int sentence_number = 1;
-  int token_number = 1;
-  StringVector text_names;
+  TokenFilter token_filter(filter);
 
-  std::string args = "";
-  if (sys_dic != "") {
-    args.append(" -d ");
-    args.append(sys_dic);
-  }
-  if (user_dic != "") {
-    args.append(" -u ");
-    args.append(user_dic);
-  }
+  // parallel argorithm with Intell TBB
+  // RcppParallel doesn't get CharacterVector as input and output
+  TextParse func = TextParse(&input, results, model, token_filter, TextNormalizer(TextNormalizer::parseMode(normalize)));
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, input.size()), func);
 
-  // lattice model
-  mecab_model_t* model;
+  mecab_model_destroy(model);
+
+  utf8_input.warn();
+
+  return tokenList(results, true, text);
+}
+
+//' Call POS Tagger via `tbb::parallel_for` and return a list of surfaces only.
+//'
+//' @param text Character vector.
+//' @param sys_dic String scalar.
+//' @param user_dic String scalar.
+//' @param filter List of token filter settings.
+//' @param normalize String scalar. "none", "width" or "neologd".
+//' @return named list of character vectors.
+//'
+//' @name posParallelWakatiRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+List posParallelWakatiRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create(), std::string normalize = "none") {
+
+  Utf8Input utf8_input(text);
+  std::vector< std::string >& input = utf8_input.texts();
+
+  std::vector< WakatiDoc > results(input.size());
 
   // create model
-  model = mecab_model_new2(args.c_str());
+  mecab_model_t* model = newModel(sys_dic, user_dic);
   if (!model) {
-    Rcerr << "model is NULL" << std::endl;
     return R_NilValue;
   }
 
+  TokenFilter token_filter(filter);
+
   // parallel argorithm with Intell TBB
   // RcppParallel doesn't get CharacterVector as input and output
-  TextParseDF func = TextParseDF(&input, results, model);
+  TextParseWakati<false> func(&input, results, model, token_filter, TextNormalizer(TextNormalizer::parseMode(normalize)));
   tbb::parallel_for(tbb::blocked_range<size_t>(0, input.size()), func);
 
   mecab_model_destroy(model);
 
-  // explicit type conversion
+  List result(input.size());
   for (size_t k = 0; k < results.size(); ++k) {
-    for (size_t l = 0; l < results[k].size(); l += 4) {
-      token_t = results[k][l];
-      pos_t = results[k][l + 1];
-      subtype_t = results[k][l + 2];
-      analytic_t = results[k][l + 3];
-
-      // if (subtype_t == "*") {
-      //   subtype_t = "";
-      // }
-      // if (analytic_t == "*") {
-      //   analytic_t = "";
-      // }
-
-      token_t.set_encoding(CE_UTF8);
-      pos_t.set_encoding(CE_UTF8);
-      subtype_t.set_encoding(CE_UTF8);
-      analytic_t.set_encoding(CE_UTF8);
-
-      token.push_back(token_t);
-      pos.push_back(pos_t);
-      subtype.push_back(subtype_t);
-      analytic.push_back(analytic_t);
-
-      token_id.push_back(token_number);
-      token_number++;
-
-      // append sentence_id and token_id
-      sentence_id.push_back(sentence_number);
-      if (token_t == "." or token_t == "。") {
-        sentence_number++;
-        token_number = 1;
-      }
-
-      // append doc_id
-      doc_id.push_back(doc_number + 1);
-
+    const WakatiDoc& doc = results[k];
+    StringVector resultString(doc.ends.size());
+    for (size_t l = 0, begin = 0; l < doc.ends.size(); ++l) {
+      SET_STRING_ELT(resultString, l, Rf_mkCharLenCE(doc.surfaces.data() + begin, doc.ends[l] - static_cast<int>(begin), CE_UTF8));
+      begin = doc.ends[l];
     }
-    sentence_number = 1;
-    token_number = 1;
-    doc_number++;
+    result[k] = resultString;
+    std::string().swap(results[k].surfaces);
   }
 
-  return DataFrame::create(
-    _["doc_id"] = doc_id,
-    _["sentence_id"] = sentence_id,
-    _["token_id"] = token_id,
-    _["token"] = token,
-    _["pos"] = pos,
-    _["subtype"] = subtype,
-    _["analytic"] = analytic,
-    _["stringsAsFactors"] = false);
+  // names keep the encoding of the original text
+  result.names() = StringVector(text.begin(), text.end());
+
+  utf8_input.warn();
+
+  return result;
 }
 
-//' Call POS Tagger via `tbb::parallel_for` and return a list of named character vectors.
+//' Call POS Tagger via `tbb::parallel_for` and return flat token and tag vectors with document offsets.
 //'
 //' @param text Character vector.
 //' @param sys_dic String scalar.
 //' @param user_dic String scalar.
-//' @return list of named character vectors.
+//' @param filter List of token filter settings.
+//' @param normalize String scalar. "none", "width" or "neologd".
+//' @return list of `token`, `tag` and `offsets`; `offsets` is double when there are more than `INT_MAX` tokens.
 //'
-//' @name posParallelRcpp
+//' @name posParallelFlatRcpp
 //' @keywords internal
 //' @export
 //
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::export]]
-List posParallelRcpp( std::vector<std::string> text, std::string sys_dic, std::string user_dic ) {
-
-  std::vector< std::vector < std::string > > results(text.size());
-  List result;
+List posParallelFlatRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create(), std::string normalize = "none") {
 
-  std::string args = "";
-  if (sys_dic != "") {
-    args.append(" -d ");
-    args.append(sys_dic);
-  }
-  if (user_dic != "") {
-    args.append(" -u ");
-    args.append(user_dic);
-  }
+  Utf8Input utf8_input(text);
+  std::vector< std::string >& input = utf8_input.texts();
 
-  // lattice model
-  mecab_model_t* model;
+  std::vector< WakatiDoc > results(input.size());
 
   // create model
-  model = mecab_model_new2(args.c_str());
+  mecab_model_t* model = newModel(sys_dic, user_dic);
   if (!model) {
-    Rcerr << "model is NULL" << std::endl;
     return R_NilValue;
   }
 
+  TokenFilter token_filter(filter);
+
   // parallel argorithm with Intell TBB
   // RcppParallel doesn't get CharacterVector as input and output
-  TextParse func = TextParse(&text, results, model);
-  tbb::parallel_for(tbb::blocked_range<size_t>(0, text.size()), func);
+  TextParseWakati<true> func(&input, results, model, token_filter, TextNormalizer(TextNormalizer::parseMode(normalize)));
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, input.size()), func);
 
   mecab_model_destroy(model);
 
-  // explicit type conversion
+  // document k holds tokens offsets[k] + 1 to offsets[k + 1]
+  std::vector<R_xlen_t> offsets(input.size() + 1, 0);
+  for (size_t k = 0; k < results.size(); ++k) {
+    offsets[k + 1] = offsets[k] + static_cast<R_xlen_t>(results[k].ends.size());
+  }
+
+  StringVector token(offsets[input.size()]);
+  StringVector tag(offsets[input.size()]);
   for (size_t k = 0; k < results.size(); ++k) {
-    CharacterVector resultString;
-    CharacterVector resultTag;
-    for (size_t l = 0; l < results[k].size(); l += 2) {
-      String morph_copy; // type conversion to Rcpp::String and set encoding
-      String tags_copy;
-      morph_copy = results[k][l];
-      tags_copy = results[k][l + 1];
-      morph_copy.set_encoding(CE_UTF8);
-      tags_copy.set_encoding(CE_UTF8);
-      resultString.push_back(morph_copy);
-      resultTag.push_back(tags_copy);
+    const WakatiDoc& doc = results[k];
+    R_xlen_t t = offsets[k];
+    for (size_t l = 0, begin = 0, tag_begin = 0; l < doc.ends.size(); ++l, ++t) {
+      SET_STRING_ELT(token, t, Rf_mkCharLenCE(doc.surfaces.data() + begin, doc.ends[l] - static_cast<int>(begin), CE_UTF8));
+      SET_STRING_ELT(tag, t, Rf_mkCharLenCE(doc.tags.data() + tag_begin, doc.tag_ends[l] - static_cast<int>(tag_begin), CE_UTF8));
+      begin = doc.ends[l];
+      tag_begin = doc.tag_ends[l];
     }
-    resultString.names() = resultTag;
-    result.push_back(resultString);
+    std::string().swap(results[k].surfaces);
+    std::string().swap(results[k].tags);
   }
 
-  StringVector result_name(text.size());
+  utf8_input.warn();
 
-  for (size_t h = 0; h < text.size(); ++h) {
-    String character_name = text[h];
-    character_name.set_encoding(CE_UTF8);
-    result_name[h] = character_name;
+  // R indexes long vectors with doubles, so the offsets are double once the
+  // total passes INT_MAX and an integer vector otherwise
+  SEXP offsets_column;
+  if (offsets[input.size()] > INT_MAX) {
+    offsets_column = wrap(std::vector<double>(offsets.begin(), offsets.end()));
+  } else {
+    offsets_column = wrap(std::vector<int>(offsets.begin(), offsets.end()));
   }
 
-  result.names() = result_name;
+  return List::create(
+    _["token"] = token,
+    _["tag"] = tag,
+    _["offsets"] = offsets_column
+  );
+}
 
-  return result;
+//' Call POS Tagger via `tbb::parallel_for` and return integer ids of the morphemes.
+//'
+//' @param text Character vector.
+//' @param sys_dic String scalar.
+//' @param user_dic String scalar.
+//' @param filter List of token filter settings.
+//' @param tag Logical. Types are "morpheme/tag" if TRUE, morphemes otherwise.
+//' @param types Character vector. Types that keep their ids, from a previous call.
+//' @param normalize String scalar. "none", "width" or "neologd".
+//' @return list of integer vectors with a `types` attribute.
+//'
+//' @name posParallelIdsRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+List posParallelIdsRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, bool tag,
+                        std::vector<std::string> types, std::string normalize = "none") {
+
+  Utf8Input utf8_input(text);
+  std::vector< std::string >& input = utf8_input.texts();
+
+  std::vector< std::vector < boost::uint32_t > > results(input.size());
+
+  // create model
+  mecab_model_t* model = newModel(sys_dic, user_dic);
+  if (!model) {
+    return R_NilValue;
+  }
+
+  TokenFilter token_filter(filter);
+
+  ShardedVocabulary vocabulary;
+  std::vector< boost::uint32_t > seeds(types.size());
+  for (size_t t = 0; t < types.size(); ++t) {
+    seeds[t] = vocabulary.code(types[t]);
+  }
+
+  // parallel argorithm with Intell TBB
+  // RcppParallel doesn't get CharacterVector as input and output
+  if (tag) {
+    TextParseIds<true> func(&input, results, model, token_filter, vocabulary, TextNormalizer(TextNormalizer::parseMode(normalize)));
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, input.size()), func);
+  } else {
+    TextParseIds<false> func(&input, results, model, token_filter, vocabulary, TextNormalizer(TextNormalizer::parseMode(normalize)));
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, input.size()), func);
+  }
+
+  mecab_model_destroy(model);
+
+  // given types keep their ids, new ones follow in order of appearance
+  Renumbering ids(vocabulary);
+  for (size_t t = 0; t < seeds.size(); ++t) {
+    ids.id(seeds[t]);
+  }
+
+  List result(input.size());
+  std::vector<int> doc;
+  for (size_t k = 0; k < results.size(); ++k) {
+    doc.resize(results[k].size());
+    for (size_t l = 0; l < results[k].size(); ++l) {
+      doc[l] = ids.id(results[k][l]);
+    }
+    result[k] = IntegerVector(doc.begin(), doc.end());
+    std::vector< boost::uint32_t >().swap(results[k]);
+  }
+
+  StringVector result_types(ids.size());
+  for (size_t t = 0; t < ids.size(); ++t) {
+    result_types[t] = makeUtf8Char(ids.type(t + 1));
+  }
+  result.attr("types") = result_types;
+
+  utf8_input.warn();
+
+  return result;
+}
+
+//' Call POS Tagger via `tbb::parallel_for` and return n-grams.
+//'
+//' @param text Character vector.
+//' @param sys_dic String scalar.
+//' @param user_dic String scalar.
+//' @param filter List of token filter settings.
+//' @param n_min Integer scalar.
+//' @param n_max Integer scalar.
+//' @param sep String scalar.
+//' @param tag Logical scalar.
+//' @param format String scalar, one of "list", "data.frame" or "count".
+//' @param normalize String scalar. "none", "width" or "neologd".
+//' @return named list or data.frame.
+//'
+//' @name posParallelNgramRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+List posParallelNgramRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, int n_min, int n_max, std::string sep, bool tag, std::string format, std::string normalize = "none") {
+
+  Utf8Input utf8_input(text);
+  std::vector< std::string >& input = utf8_input.texts();
+
+  std::vector< std::vector < std::string > > results(input.size());
+  std::vector< std::vector < int > > values(input.size());
+
+  if (n_min < 1 || n_max < n_min) {
+    stop("Invalid n-gram range.");
+  }
+
+  // create model
+  mecab_model_t* model = newModel(sys_dic, user_dic);
+  if (!model) {
+    return R_NilValue;
+  }
+
+  TokenFilter token_filter(filter);
+  const bool count = format == "count";
+
+  // parallel argorithm with Intell TBB
+  // RcppParallel doesn't get CharacterVector as input and output
+  TextParseNgram func = TextParseNgram(&input, results, values, model, token_filter, n_min, n_max, sep, tag, count,
+                                       TextNormalizer(TextNormalizer::parseMode(normalize)));
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, input.size()), func);
+
+  mecab_model_destroy(model);
+
+  // every format returns early, so warn before building any of them
+  utf8_input.warn();
+
+  if (format == "list") {
+    return tokenList(results, false, text);
+  }
+
+  size_t n_rows = 0;
+  for (size_t k = 0; k < results.size(); ++k) {
+    n_rows += results[k].size();
+  }
+
+  std::vector<int> doc_id;
+  std::vector<int> value;
+  doc_id.reserve(n_rows);
+  value.reserve(n_rows);
+  for (size_t k = 0; k < results.size(); ++k) {
+    doc_id.insert(doc_id.end(), results[k].size(), static_cast<int>(k + 1));
+    value.insert(value.end(), values[k].begin(), values[k].end());
+  }
+
+  if (!count) {
+    std::vector<std::string> ngram;
+    ngram.reserve(n_rows);
+    for (size_t k = 0; k < results.size(); ++k) {
+      ngram.insert(ngram.end(), results[k].begin(), results[k].end());
+    }
+    return makeDataFrame(List::create(
+      _["doc_id"] = wrap(doc_id),
+      _["sentence_id"] = wrap(value),
+      _["ngram"] = makeStringColumn(ngram)
+    ), n_rows);
+  }
+
+  // n-grams as a factor over a corpus-wide vocabulary, so that
+  // (doc_id, ngram, count) are the triplets of a sparse matrix
+  std::unordered_map<std::string, int> vocabulary;
+  std::vector<std::string> levels;
+  IntegerVector ngram(n_rows);
+  size_t row = 0;
+  for (size_t k = 0; k < results.size(); ++k) {
+    for (size_t l = 0; l < results[k].size(); ++l) {
+      std::unordered_map<std::string, int>::iterator it = vocabulary.find(results[k][l]);
+      if (it == vocabulary.end()) {
+        levels.push_back(results[k][l]);
+        it = vocabulary.insert(std::make_pair(results[k][l], static_cast<int>(levels.size()))).first;
+      }
+      ngram[row++] = it->second;
+    }
+  }
+  ngram.attr("levels") = makeStringColumn(levels);
+  ngram.attr("class") = "factor";
+
+  return makeDataFrame(List::create(
+    _["doc_id"] = wrap(doc_id),
+    _["ngram"] = ngram,
+    _["count"] = wrap(value)
+  ), n_rows);
+}
+
+//' Call POS Tagger via `tbb::parallel_for` and return packed documents.
+//'
+//' @param text Character vector.
+//' @param sys_dic String scalar.
+//' @param user_dic String scalar.
+//' @param filter List of token filter settings.
+//' @param collapse String scalar.
+//' @param normalize String scalar. "none", "width" or "neologd".
+//' @return data.frame.
+//'
+//' @name posParallelPackRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+DataFrame posParallelPackRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, std::string collapse, std::string normalize = "none") {
+
+  Utf8Input utf8_input(text);
+  std::vector< std::string >& input = utf8_input.texts();
+
+  std::vector< std::string > results(input.size());
+
+  // create model
+  mecab_model_t* model = newModel(sys_dic, user_dic);
+  if (!model) {
+    return R_NilValue;
+  }
+
+  TokenFilter token_filter(filter);
+
+  // parallel argorithm with Intell TBB
+  // RcppParallel doesn't get CharacterVector as input and output
+  TextParsePack func = TextParsePack(&input, results, model, token_filter, collapse, TextNormalizer(TextNormalizer::parseMode(normalize)));
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, input.size()), func);
+
+  mecab_model_destroy(model);
+
+  IntegerVector doc_id(input.size());
+  for (size_t k = 0; k < input.size(); ++k) {
+    doc_id[k] = static_cast<int>(k + 1);
+  }
+
+  utf8_input.warn();
+
+  return makeDataFrame(List::create(
+    _["doc_id"] = doc_id,
+    _["text"] = makeStringColumn(results)
+  ), input.size());
+}
+
+//' Call POS Tagger via `tbb::parallel_for` and count tokens per document.
+//'
+//' @param text Character vector.
+//' @param sys_dic String scalar.
+//' @param user_dic String scalar.
+//' @param filter List of token filter settings.
+//' @param normalize String scalar. "none", "width" or "neologd".
+//' @return integer matrix of documents by counts.
+//'
+//' @name posStatsRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+SEXP posStatsRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create(), std::string normalize = "none") {
+
+  Utf8Input utf8_input(text);
+  std::vector< std::string >& input = utf8_input.texts();
+
+  std::vector< DocStats > results(input.size());
+
+  // create model
+  mecab_model_t* model = newModel(sys_dic, user_dic);
+  if (!model) {
+    return R_NilValue;
+  }
+
+  TokenFilter token_filter(filter);
+
+  // parallel argorithm with Intell TBB
+  // RcppParallel doesn't get CharacterVector as input and output
+  TextParseStats func = TextParseStats(&input, results, model, token_filter, TextNormalizer(TextNormalizer::parseMode(normalize)));
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, input.size()), func);
+
+  mecab_model_destroy(model);
+
+  // POS columns in order of first appearance over the documents
+  std::vector<std::string> columns;
+  columns.push_back("tokens");
+  columns.push_back("unknown");
+  columns.push_back("chars");
+  std::unordered_map<std::string, size_t> column_index;
+  for (size_t k = 0; k < results.size(); ++k) {
+    for (size_t p = 0; p < results[k].pos.size(); ++p) {
+      if (column_index.insert(std::make_pair(results[k].pos[p].first, columns.size())).second) {
+        columns.push_back(results[k].pos[p].first);
+      }
+    }
+  }
+
+  IntegerMatrix stats(static_cast<int>(input.size()), static_cast<int>(columns.size()));
+  for (size_t k = 0; k < results.size(); ++k) {
+    stats(k, 0) = results[k].tokens;
+    stats(k, 1) = results[k].unknown;
+    stats(k, 2) = results[k].chars;
+    for (size_t p = 0; p < results[k].pos.size(); ++p) {
+      stats(k, column_index[results[k].pos[p].first]) = results[k].pos[p].second;
+    }
+  }
+
+  StringVector column_names(columns.size());
+  for (size_t c = 0; c < columns.size(); ++c) {
+    column_names[c] = makeUtf8Char(columns[c]);
+  }
+  stats.attr("dimnames") = List::create(R_NilValue, column_names);
+
+  utf8_input.warn();
+
+  return stats;
+}
+
+//' Call POS Tagger via `tbb::parallel_for` and write the tokens to a binary columnar file.
+//'
+//' @param text Character vector.
+//' @param sys_dic String scalar.
+//' @param user_dic String scalar.
+//' @param filter List of token filter settings.
+//' @param file String scalar.
+//' @param doc_names Character vector. Empty if documents have no names.
+//' @param batch_size Integer. Number of documents parsed at once.
+//' @return list of `n_docs` and `n_tokens`.
+//'
+//' @name writeTokensRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+List writeTokensRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, std::string file, std::vector<std::string> doc_names, int batch_size) {
+
+  Utf8Input utf8_input(text);
+  std::vector< std::string >& input = utf8_input.texts();
+
+  if (!doc_names.empty() && doc_names.size() != input.size()) {
+    stop("doc_names should have the same length as text.");
+  }
+  if (batch_size < 1) {
+    stop("batch_size should be a positive integer.");
+  }
+
+  // create model
+  mecab_model_t* model = newModel(sys_dic, user_dic);
+  if (!model) {
+    return R_NilValue;
+  }
+
+  TokenFilter token_filter(filter);
+
+  // feature columns depend on the system dictionary
+  const DicSchema schema = detectDicSchema(model);
+  std::vector<std::string> columns;
+  columns.push_back("token");
+  columns.insert(columns.end(), schema.columns.begin(), schema.columns.end());
+
+  tokenstore::Writer writer(columns);
+
+  // parse in batches, so only one batch of parsed strings is held at once
+  for (size_t begin = 0; begin < input.size(); begin += batch_size) {
+    const size_t end = std::min(input.size(), begin + static_cast<size_t>(batch_size));
+    std::vector< std::string > batch(input.begin() + begin, input.begin() + end);
+    std::vector< std::vector < std::string > > results(batch.size());
+    std::vector< std::vector < int > > ids(batch.size());
+
+    // parallel argorithm with Intell TBB
+    TextParseDF func = TextParseDF(&batch, results, ids, model, token_filter, schema);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, batch.size()), func);
+
+    for (size_t k = 0; k < batch.size(); ++k) {
+      writer.addDocument(results[k], ids[k], doc_names.empty() ? NULL : &doc_names[begin + k]);
+    }
+
+    checkUserInterrupt();
+  }
+
+  mecab_model_destroy(model);
+
+  writer.write(file);
+
+  utf8_input.warn();
+
+  return List::create(
+    _["n_docs"] = static_cast<double>(writer.nDocs()),
+    _["n_tokens"] = static_cast<double>(writer.nTokens())
+  );
+}
+
+// Arrow stream of token record batches. Each `get_next()` parses the next
+// `batch_size` documents, so the corpus is never held in memory at once.
+struct ArrowTokenStream
+{
+  std::vector<std::string> text;
+  mecab_model_t* model;
+  TokenFilter filter;
+  DicSchema schema;
+  TextNormalizer normalizer;
+  std::shared_ptr<const arrowexport::StringBuffers> doc_labels;
+  size_t batch_size;
+  size_t next;
+  std::string error;
+
+  ArrowTokenStream(const TokenFilter& filter, const DicSchema& schema)
+    : model(NULL), filter(filter), schema(schema), batch_size(1), next(0)
+  {}
+};
+
+static int arrowTokenStreamSchema(ArrowArrayStream* stream, ArrowSchema* out) {
+  const ArrowTokenStream* data = static_cast<ArrowTokenStream*>(stream->private_data);
+
+  std::vector<ArrowSchema> children(4 + data->schema.columns.size());
+  arrowexport::makeSchema(&children[0], "i", "doc_id", false);
+  arrowexport::setSchemaDictionary(&children[0], "u");
+  arrowexport::makeSchema(&children[1], "i", "sentence_id", false);
+  arrowexport::makeSchema(&children[2], "i", "token_id", false);
+  arrowexport::makeSchema(&children[3], "u", "token", true);
+  for (size_t f = 0; f < data->schema.columns.size(); ++f) {
+    arrowexport::makeSchema(&children[4 + f], "u", data->schema.columns[f], true);
+  }
+
+  arrowexport::makeSchema(out, "+s", "", false);
+  arrowexport::setSchemaChildren(out, children);
+  return 0;
+}
+
+static int arrowTokenStreamNext(ArrowArrayStream* stream, ArrowArray* out) {
+  ArrowTokenStream* data = static_cast<ArrowTokenStream*>(stream->private_data);
+
+  // end of stream
+  if (data->next >= data->text.size()) {
+    out->release = NULL;
+    return 0;
+  }
+
+  try {
+    const size_t begin = data->next;
+    const size_t end = std::min(data->text.size(), begin + data->batch_size);
+    std::vector< std::string > input(data->text.begin() + begin, data->text.begin() + end);
+    std::vector< std::vector < std::string > > results(input.size());
+    std::vector< std::vector < int > > ids(input.size());
+
+    // parallel argorithm with Intell TBB
+    TextParseDF func = TextParseDF(&input, results, ids, data->model, data->filter, data->schema,
+                                 NULL, TokenOffset::NONE, NULL, NULL, data->normalizer);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, input.size()), func);
+
+    const size_t stride = 1 + data->schema.fields.size();
+    std::vector<int32_t> doc_id;
+    std::vector<int32_t> sentence_id;
+    std::vector<int32_t> token_id;
+    std::vector< std::shared_ptr<arrowexport::StringBuffers> > strings(stride);
+    for (size_t c = 0; c < stride; ++c) {
+      strings[c] = std::make_shared<arrowexport::StringBuffers>();
+    }
+
+    // offsets and UTF-8 buffers straight from the worker results
+    for (size_t k = 0; k < results.size(); ++k) {
+      for (size_t l = 0, t = 0; l < results[k].size(); l += stride, ++t) {
+        for (size_t c = 0; c < stride; ++c) {
+          const std::string& value = results[k][l + c];
+          if (!strings[c]->add(value, value == "*")) {
+            data->error = "a column of the batch exceeds 2GB; use a smaller batch_size";
+            return EOVERFLOW;
+          }
+        }
+        doc_id.push_back(static_cast<int32_t>(begin + k));
+        sentence_id.push_back(ids[k][2 * t]);
+        token_id.push_back(ids[k][2 * t + 1]);
+      }
+      std::vector< std::string >().swap(results[k]);
+    }
+
+    const int64_t n_rows = static_cast<int64_t>(doc_id.size());
+    std::vector<ArrowArray> children(3 + stride);
+    arrowexport::makeInt32Array(&children[0], doc_id);
+    arrowexport::setArrayDictionary(&children[0], data->doc_labels);
+    arrowexport::makeInt32Array(&children[1], sentence_id);
+    arrowexport::makeInt32Array(&children[2], token_id);
+    for (size_t c = 0; c < stride; ++c) {
+      arrowexport::makeStringArray(&children[3 + c], strings[c]);
+    }
+    arrowexport::makeStructArray(out, n_rows, children);
+
+    data->next = end;
+    return 0;
+  } catch (std::exception& e) {
+    data->error = e.what();
+    return EIO;
+  }
+}
+
+static const char* arrowTokenStreamError(ArrowArrayStream* stream) {
+  const ArrowTokenStream* data = static_cast<ArrowTokenStream*>(stream->private_data);
+  return data->error.empty() ? NULL : data->error.c_str();
+}
+
+static void arrowTokenStreamRelease(ArrowArrayStream* stream) {
+  ArrowTokenStream* data = static_cast<ArrowTokenStream*>(stream->private_data);
+  mecab_model_destroy(data->model);
+  delete data;
+  stream->release = NULL;
+}
+
+//' Call POS Tagger via `tbb::parallel_for` and export an Arrow C stream of record batches.
+//'
+//' @param text Character vector.
+//' @param sys_dic String scalar.
+//' @param user_dic String scalar.
+//' @param filter List of token filter settings.
+//' @param doc_names Character vector. Labels of `doc_id`, one per document.
+//' @param batch_size Integer. Number of documents in a record batch.
+//' @param stream External pointer to an empty `ArrowArrayStream`.
+//' @param normalize String scalar. "none", "width" or "neologd".
+//' @return `stream`.
+//'
+//' @name posParallelArrowRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+SEXP posParallelArrowRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, std::vector<std::string> doc_names, int batch_size, SEXP stream, std::string normalize = "none") {
+
+  Utf8Input utf8_input(text);
+  std::vector< std::string >& input = utf8_input.texts();
+
+  ArrowArrayStream* out = static_cast<ArrowArrayStream*>(R_ExternalPtrAddr(stream));
+  if (!out) {
+    stop("stream should be an external pointer to an ArrowArrayStream.");
+  }
+  if (doc_names.size() != input.size()) {
+    stop("doc_names should have the same length as text.");
+  }
+  if (batch_size < 1) {
+    stop("batch_size should be a positive integer.");
+  }
+
+  // create model
+  mecab_model_t* model = newModel(sys_dic, user_dic);
+  if (!model) {
+    return R_NilValue;
+  }
+
+  ArrowTokenStream* data = new ArrowTokenStream(TokenFilter(filter), detectDicSchema(model));
+  data->text.swap(input);
+  data->model = model;
+  data->batch_size = static_cast<size_t>(batch_size);
+  data->normalizer = TextNormalizer(TextNormalizer::parseMode(normalize));
+
+  std::shared_ptr<arrowexport::StringBuffers> labels = std::make_shared<arrowexport::StringBuffers>();
+  for (size_t k = 0; k < doc_names.size(); ++k) {
+    labels->add(doc_names[k], false);
+  }
+  data->doc_labels = labels;
+
+  out->get_schema = arrowTokenStreamSchema;
+  out->get_next = arrowTokenStreamNext;
+  out->get_last_error = arrowTokenStreamError;
+  out->release = arrowTokenStreamRelease;
+  out->private_data = data;
+
+  utf8_input.warn();
+
+  return stream;
+}
+
+// Parse the documents of a server request with the parallel workers. Runs on
+// a server thread, so nothing here may touch R.
+static void serveTokens(mecab_model_t* model, const DicSchema& schema,
+                        const tokenserver::Request& request, tokenserver::Reply& reply) {
+  const TokenFilter token_filter(request.keep_pos, request.drop_pos, request.stopwords, request.min_len, request.max_len);
+  const TextNormalizer normalizer(TextNormalizer::parseMode(request.normalize));
+  const size_t n = request.texts.size();
+
+  // invalid UTF-8 is replaced by U+FFFD as Utf8Input does for R input; the
+  // texts are copied only when one of them needs it
+  std::vector<std::string> repaired;
+  const std::vector<std::string>* texts = &request.texts;
+  for (size_t k = 0; k < n; ++k) {
+    const std::string& text = request.texts[k];
+    if (!isValidUtf8(text.data(), text.size())) {
+      if (texts != &repaired) {
+        repaired = request.texts;
+        texts = &repaired;
+      }
+      repaired[k] = repairUtf8(text.data(), text.size());
+    }
+  }
+
+  reply.results.resize(n);
+  if (request.format == "join") {
+    TextParseJoin func = TextParseJoin(texts, reply.results, model, token_filter, normalizer);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, n), func);
+  } else if (request.format == "list") {
+    TextParse func = TextParse(texts, reply.results, model, token_filter, normalizer);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, n), func);
+  } else if (request.format == "data.frame") {
+    reply.columns = schema.columns;
+    reply.ids.resize(n);
+    TextParseDF func = TextParseDF(texts, reply.results, reply.ids, model, token_filter, schema,
+                                   NULL, TokenOffset::NONE, NULL, NULL, normalizer);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, n), func);
+  } else {
+    reply.results.clear();
+    reply.error = "unknown format: " + request.format;
+  }
+}
+
+//' Serve POS tagging on a Unix domain socket until stopped.
+//'
+//' @param socket String scalar. Path of the socket.
+//' @param sys_dic String scalar.
+//' @param user_dic String scalar.
+//' @param threads Integer. Number of connections served at once.
+//' @return `TRUE` after a shutdown request.
+//'
+//' @name mecabServeRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+SEXP mecabServeRcpp(std::string socket, std::string sys_dic, std::string user_dic, int threads) {
+
+  // create model
+  mecab_model_t* model = newModel(sys_dic, user_dic);
+  if (!model) {
+    return R_NilValue;
+  }
+
+  const DicSchema schema = detectDicSchema(model);
+
+  try {
+    tokenserver::Server server(socket, threads > 0 ? static_cast<size_t>(threads) : 1,
+                               [model, &schema](const tokenserver::Request& request, tokenserver::Reply& reply) {
+                                 serveTokens(model, schema, request, reply);
+                               });
+    // an interrupt stops the server; its destructor waits for the workers
+    server.run([] { checkUserInterrupt(); });
+  } catch (...) {
+    mecab_model_destroy(model);
+    throw;
+  }
+
+  mecab_model_destroy(model);
+
+  return wrap(true);
+}
+
+//' Ask a POS tagging server to shut down.
+//'
+//' @param socket String scalar. Path of the socket.
+//' @return Logical. `FALSE` if no server answered.
+//'
+//' @name mecabServerStopRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+bool mecabServerStopRcpp(std::string socket) {
+  tokenserver::Request request;
+  tokenserver::Reply reply;
+  request.op = tokenserver::SHUTDOWN;
+  return tokenserver::call(socket, request, reply);
+}
+
+//' Send raw bytes to a POS tagging server, for testing malformed messages.
+//'
+//' @param socket String scalar. Path of the socket.
+//' @param frame Raw vector. Bytes sent as they are.
+//' @return String scalar. Error of the reply, NA if the server closed the connection.
+//'
+//' @name mecabServerSendRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+StringVector mecabServerSendRcpp(std::string socket, RawVector frame) {
+  tokenserver::Reply reply;
+  const std::string bytes(frame.begin(), frame.end());
+  if (!tokenserver::sendFrame(socket, bytes, reply)) {
+    return StringVector::create(NA_STRING);
+  }
+  return StringVector::create(reply.error);
+}
+
+static std::vector<std::string> filterValues(List filter, const char* name) {
+  if (!filter.containsElementNamed(name)) {
+    return std::vector<std::string>();
+  }
+  return as< std::vector<std::string> >(filter[name]);
+}
+
+//' Call POS Tagger on a server and return the result of `pos()`.
+//'
+//' @param socket String scalar. Path of the socket.
+//' @param text Character vector.
+//' @param format String scalar, one of "join", "list" or "data.frame".
+//' @param filter List of token filter settings.
+//' @param normalize String scalar. "none", "width" or "neologd".
+//' @return named list or data.frame.
+//'
+//' @name posServerRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+SEXP posServerRcpp(std::string socket, StringVector text, std::string format, List filter = List::create(), std::string normalize = "none") {
+
+  Utf8Input utf8_input(text);
+
+  tokenserver::Request request;
+  request.format = format;
+  request.normalize = normalize;
+  request.keep_pos = filterValues(filter, "keep_pos");
+  request.drop_pos = filterValues(filter, "drop_pos");
+  request.stopwords = filterValues(filter, "stopwords");
+  if (filter.containsElementNamed("min_len")) {
+    request.min_len = as<int>(filter["min_len"]);
+  }
+  if (filter.containsElementNamed("max_len")) {
+    request.max_len = as<int>(filter["max_len"]);
+  }
+  request.texts.swap(utf8_input.texts());
+
+  tokenserver::Reply reply;
+  if (!tokenserver::call(socket, request, reply)) {
+    stop("No MeCab server answered on " + socket + ".");
+  }
+  if (!reply.error.empty()) {
+    stop(reply.error);
+  }
+  if (reply.results.size() != request.texts.size()) {
+    stop("The MeCab server returned a wrong number of documents.");
+  }
+
+  utf8_input.warn();
+
+  if (format == "data.frame") {
+    return tokenDataFrame(reply.results, reply.ids, reply.columns);
+  }
+  return tokenList(reply.results, format == "list", text);
+}
+
+// Runs a parse functor over small ranges, counting the parsed documents and
+// skipping the remaining ranges once the job is cancelled.
+template <typename Parse>
+struct JobProgress
+{
+  JobProgress(const Parse& parse, AsyncJob& job)
+    : parse_(parse), job_(job)
+  {}
+
+  void operator()(const tbb::blocked_range<size_t>& range) const
+  {
+    if (job_.cancelled()) {
+      return;
+    }
+    parse_(range);
+    job_.advance(range.size());
+  }
+
+  const Parse& parse_;
+  AsyncJob& job_;
+};
+
+template <typename Parse>
+static void runJob(const Parse& parse, AsyncJob& job) {
+  // ranges of a few documents, so progress and cancellation stay responsive
+  const size_t grain = 64;
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, job.total(), grain), JobProgress<Parse>(parse, job), tbb::simple_partitioner());
+}
+
+// State of a posAsync() call. The job is declared last and waited for in the
+// destructor, so the worker never outlives what it writes to.
+struct ParseJob
+{
+  ParseJob(const std::string& format, mecab_model_t* model, const TokenFilter& filter, size_t n)
+    : format(format), model(model), filter(filter), schema(detectDicSchema(model)),
+      offset_mode(TokenOffset::NONE), expand(false),
+      results(n), ids(n), spans(n), parents(n), job(n)
+  {}
+
+  ~ParseJob() {
+    job.cancel();
+    job.wait();
+    mecab_model_destroy(model);
+  }
+
+  std::string format;
+  std::vector<std::string> text;
+  mecab_model_t* model;
+  TokenFilter filter;
+  DicSchema schema;
+  TokenOffset::Mode offset_mode;
+  bool expand;
+  TextNormalizer normalizer;
+  std::vector< std::vector < std::string > > results;
+  std::vector< std::vector < int > > ids;
+  std::vector< std::vector < int > > spans;
+  std::vector< std::vector < int > > parents;
+  AsyncJob job;
+};
+
+typedef XPtr<ParseJob> ParseJobPtr;
+
+static ParseJob* parseJob(SEXP pointer) {
+  ParseJob* data = static_cast<ParseJob*>(R_ExternalPtrAddr(pointer));
+  if (!data) {
+    stop("The job is no longer available.");
+  }
+  return data;
+}
+
+//' Start POS Tagger on a background thread and return a job pointer.
+//'
+//' @param text Character vector.
+//' @param sys_dic String scalar.
+//' @param user_dic String scalar.
+//' @param filter List of token filter settings.
+//' @param format String scalar, one of "join", "list" or "data.frame".
+//' @param offset String scalar. "none", "byte" or "char".
+//' @param expand Logical. Expand mecab-ko-dic expressions into component rows.
+//' @param normalize String scalar. "none", "width" or "neologd".
+//' @return external pointer.
+//'
+//' @name posAsyncRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+SEXP posAsyncRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter, std::string format,
+                  std::string offset = "none", bool expand = false, std::string normalize = "none") {
+
+  if (format != "join" && format != "list" && format != "data.frame") {
+    stop("format should be one of \"join\", \"list\" or \"data.frame\".");
+  }
+
+  Utf8Input utf8_input(text);
+  std::vector< std::string >& input = utf8_input.texts();
+
+  // create model
+  mecab_model_t* model = newModel(sys_dic, user_dic);
+  if (!model) {
+    return R_NilValue;
+  }
+
+  ParseJob* data = new ParseJob(format, model, TokenFilter(filter), input.size());
+  ParseJobPtr pointer(data, true);
+  data->text.swap(input);
+  data->offset_mode = TokenOffset::parseMode(offset);
+  data->expand = expand;
+  data->normalizer = TextNormalizer(TextNormalizer::parseMode(normalize));
+
+  data->job.start([data](AsyncJob& job) {
+    // parallel argorithm with Intell TBB
+    if (data->format == "join") {
+      runJob(TextParseJoin(&data->text, data->results, data->model, data->filter, data->normalizer), job);
+    } else if (data->format == "list") {
+      runJob(TextParse(&data->text, data->results, data->model, data->filter, data->normalizer), job);
+    } else {
+      runJob(TextParseDF(&data->text, data->results, data->ids, data->model, data->filter, data->schema,
+                         &data->spans, data->offset_mode, data->expand ? &data->parents : NULL, NULL, data->normalizer), job);
+    }
+  });
+
+  utf8_input.warn();
+
+  return pointer;
+}
+
+//' Report the state of a background POS Tagger job.
+//'
+//' @param pointer External pointer returned by `posAsyncRcpp()`.
+//' @return list of `total`, `completed`, `finished` and `cancelled`.
+//'
+//' @name posAsyncStatusRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+List posAsyncStatusRcpp(SEXP pointer) {
+  const ParseJob* data = parseJob(pointer);
+  return List::create(
+    _["total"] = static_cast<double>(data->job.total()),
+    _["completed"] = static_cast<double>(data->job.completed()),
+    _["finished"] = data->job.finished(),
+    _["cancelled"] = data->job.cancelled()
+  );
+}
+
+//' Cancel a background POS Tagger job.
+//'
+//' @param pointer External pointer returned by `posAsyncRcpp()`.
+//' @return `TRUE` if the job was still running.
+//'
+//' @name posAsyncCancelRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+bool posAsyncCancelRcpp(SEXP pointer) {
+  ParseJob* data = parseJob(pointer);
+  const bool running = !data->job.finished();
+  data->job.cancel();
+  return running;
+}
+
+//' Wait for a background POS Tagger job and return its result.
+//'
+//' The parsed strings are released once the result is made, so a job can be
+//' collected only once.
+//'
+//' @param pointer External pointer returned by `posAsyncRcpp()`.
+//' @param text Character vector given to `posAsyncRcpp()`.
+//' @return named list or data.frame.
+//'
+//' @name posAsyncCollectRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+SEXP posAsyncCollectRcpp(SEXP pointer, StringVector text) {
+  ParseJob* data = parseJob(pointer);
+
+  // keep the R main thread interruptible while waiting
+  while (!data->job.finished()) {
+    checkUserInterrupt();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+  data->job.wait();
+
+  if (!data->job.error().empty()) {
+    stop(data->job.error());
+  }
+  if (data->job.cancelled()) {
+    stop("The job was cancelled.");
+  }
+
+  SEXP result;
+  if (data->format == "data.frame") {
+    result = tokenDataFrame(data->results, data->ids, data->schema.columns,
+                            data->offset_mode != TokenOffset::NONE ? &data->spans : NULL,
+                            data->expand ? &data->parents : NULL);
+  } else {
+    result = tokenList(data->results, data->format == "list", text);
+  }
+
+  // the strings now live in R or in the lazy columns
+  ParseJobPtr(pointer).release();
+
+  return result;
+}
+
+// Every candidate node of a document's lattice, column by column.
+struct LatticeNodes
+{
+  std::vector<int> start;
+  std::vector<int> end;
+  std::vector<int> posid;
+  std::vector<int> left_id;
+  std::vector<int> right_id;
+  std::vector<int> char_type;
+  std::vector<int> unknown;
+  std::vector<int> wcost;
+  std::vector<double> cost;
+  std::vector<int> best;
+  std::vector<double> alpha;
+  std::vector<double> beta;
+  std::vector<double> prob;
+  std::vector<std::string> surface;
+  std::vector<std::string> feature;
+};
+
+struct TextParseLattice
+{
+  TextParseLattice(const std::vector<std::string>* sentences, std::vector<LatticeNodes>& result, mecab_model_t* model, bool marginal,
+                   TextNormalizer normalizer = TextNormalizer())
+    : sentences_(sentences), result_(result), model_(model), marginal_(marginal), normalizer_(normalizer)
+  {}
+
+  void operator()(const tbb::blocked_range<size_t>& range) const
+  {
+    mecab_t* tagger = mecab_model_new_tagger(model_);
+    mecab_lattice_t* lattice = mecab_model_new_lattice(model_);
+    const mecab_node_t* node;
+    std::string normalized;
+    NormalizeMap map;
+    std::vector<int> chars;
+
+    for (size_t i = range.begin(); i < range.end(); ++i) {
+      LatticeNodes& nodes = result_[i];
+      const std::string& text = (*sentences_)[i];
+
+      setLatticeSentence(lattice, text, normalizer_, normalized, &map);
+      mecab_lattice_set_request_type(lattice, MECAB_ALL_MORPHS | (marginal_ ? MECAB_MARGINAL_PROB : 0));
+      mecab_parse_lattice(tagger, lattice);
+
+      // characters before each byte of the original text, for the offsets
+      chars.assign(text.size() + 1, 0);
+      for (size_t b = 0; b < text.size(); ++b) {
+        chars[b + 1] = chars[b] + ((static_cast<unsigned char>(text[b]) & 0xC0) != 0x80);
+      }
+
+      const char* sentence = mecab_lattice_get_sentence(lattice);
+      const size_t len = mecab_lattice_get_size(lattice);
+
+      // candidates are chained by `bnext` from the nodes beginning at each byte
+      for (size_t pos = 0; pos < len; ++pos) {
+        for (node = mecab_lattice_get_begin_nodes(lattice, pos); node; node = node->bnext) {
+          if (node->stat == MECAB_BOS_NODE || node->stat == MECAB_EOS_NODE) {
+            continue;
+          }
+          size_t begin = static_cast<size_t>(node->surface - sentence);
+          size_t last = begin + node->length;
+          if (normalizer_.active() && node->length > 0) {
+            last = map.end[last - 1];
+            begin = map.begin[begin];
+          }
+
+          nodes.start.push_back(chars[begin] + 1);
+          nodes.end.push_back(chars[last]);
+          nodes.posid.push_back(node->posid);
+          nodes.left_id.push_back(node->lcAttr);
+          nodes.right_id.push_back(node->rcAttr);
+          nodes.char_type.push_back(node->char_type);
+          nodes.unknown.push_back(node->stat == MECAB_UNK_NODE);
+          nodes.wcost.push_back(node->wcost);
+          nodes.cost.push_back(static_cast<double>(node->cost));
+          nodes.best.push_back(node->isbest != 0);
+          if (marginal_) {
+            nodes.alpha.push_back(node->alpha);
+            nodes.beta.push_back(node->beta);
+            nodes.prob.push_back(node->prob);
+          }
+          nodes.surface.push_back(std::string(node->surface, node->length));
+          nodes.feature.push_back(node->feature);
+        }
+      }
+    }
+
+    mecab_lattice_destroy(lattice);
+    mecab_destroy(tagger);
+  }
+
+  const std::vector<std::string>* sentences_;
+  std::vector<LatticeNodes>& result_;
+  mecab_model_t* model_;
+  bool marginal_;
+  TextNormalizer normalizer_;
+};
+
+template <typename T>
+static void appendColumn(std::vector<T>& column, std::vector<T>& values) {
+  column.insert(column.end(), values.begin(), values.end());
+  std::vector<T>().swap(values);
+}
+
+//' Call POS Tagger via `tbb::parallel_for` and return every node of the lattices.
+//'
+//' @param text Character vector.
+//' @param sys_dic String scalar.
+//' @param user_dic String scalar.
+//' @param marginal Logical. Compute the marginal probabilities of the nodes.
+//' @param normalize String scalar. "none", "width" or "neologd".
+//' @return data.frame of lattice nodes.
+//'
+//' @name posLatticeRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+DataFrame posLatticeRcpp(StringVector text, std::string sys_dic, std::string user_dic, bool marginal = false, std::string normalize = "none") {
+
+  Utf8Input utf8_input(text);
+  std::vector< std::string >& input = utf8_input.texts();
+
+  std::vector< LatticeNodes > results(input.size());
+
+  // create model
+  mecab_model_t* model = newModel(sys_dic, user_dic, marginal ? " -m" : "");
+  if (!model) {
+    return R_NilValue;
+  }
+
+  // parallel argorithm with Intell TBB
+  // RcppParallel doesn't get CharacterVector as input and output
+  TextParseLattice func = TextParseLattice(&input, results, model, marginal, TextNormalizer(TextNormalizer::parseMode(normalize)));
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, input.size()), func);
+
+  mecab_model_destroy(model);
+
+  // concatenate the documents into columns, freeing each as it goes
+  LatticeNodes nodes;
+  std::vector<int> doc_id;
+  std::shared_ptr<StringArena> arena = std::make_shared<StringArena>();
+  arena->columns.resize(2);
+  for (size_t k = 0; k < results.size(); ++k) {
+    doc_id.insert(doc_id.end(), results[k].start.size(), static_cast<int>(k + 1));
+    appendColumn(nodes.start, results[k].start);
+    appendColumn(nodes.end, results[k].end);
+    appendColumn(nodes.posid, results[k].posid);
+    appendColumn(nodes.left_id, results[k].left_id);
+    appendColumn(nodes.right_id, results[k].right_id);
+    appendColumn(nodes.char_type, results[k].char_type);
+    appendColumn(nodes.unknown, results[k].unknown);
+    appendColumn(nodes.wcost, results[k].wcost);
+    appendColumn(nodes.cost, results[k].cost);
+    appendColumn(nodes.best, results[k].best);
+    appendColumn(nodes.alpha, results[k].alpha);
+    appendColumn(nodes.beta, results[k].beta);
+    appendColumn(nodes.prob, results[k].prob);
+    appendColumn(arena->columns[0], results[k].surface);
+    appendColumn(arena->columns[1], results[k].feature);
+  }
+
+  utf8_input.warn();
+
+  List columns = List::create(
+    _["doc_id"] = wrap(doc_id),
+    _["start"] = wrap(nodes.start),
+    _["end"] = wrap(nodes.end),
+    _["surface"] = makeLazyStringColumn(arena, 0, false),
+    _["posid"] = wrap(nodes.posid),
+    _["left_id"] = wrap(nodes.left_id),
+    _["right_id"] = wrap(nodes.right_id),
+    _["char_type"] = wrap(nodes.char_type),
+    _["unknown"] = LogicalVector(nodes.unknown.begin(), nodes.unknown.end()),
+    _["wcost"] = wrap(nodes.wcost),
+    _["cost"] = wrap(nodes.cost),
+    _["best"] = LogicalVector(nodes.best.begin(), nodes.best.end())
+  );
+  if (marginal) {
+    columns.push_back(wrap(nodes.alpha), "alpha");
+    columns.push_back(wrap(nodes.beta), "beta");
+    columns.push_back(wrap(nodes.prob), "prob");
+  }
+  columns.push_back(makeLazyStringColumn(arena, 1, false), "feature");
+
+  return makeDataFrame(columns, doc_id.size());
 }
@@ -6,16 +6,24 @@
 
 #include <Rcpp.h>
 #include <RcppThread.h>
-#include <boost/algorithm/string.hpp>
 #include "../inst/include/mecab.h"
+#include "tokenFilter.h"
+#include "dicSchema.h"
+#include "stringColumn.h"
+#include "lazyStrings.h"
+#include "tokenOffset.h"
+#include "utf8Input.h"
+#include "parseKernel.h"
+#include "mecabModel.h"
 
 using namespace Rcpp;
 
-//' Call POS Tagger via `lapply` and return a list of named character vectors.
+//' Call POS Tagger in a loop on this thread and return a list of named character vectors.
 //'
 //' @param text Character vector.
 //' @param sys_dic String scalar.
 //' @param user_dic String scalar.
+//' @param filter List of token filter settings.
 //' @return list of named character vectors.
 //'
 //' @name posApplyRcpp
@@ -24,96 +32,35 @@ using namespace Rcpp;
 //
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::export]]
-List posApplyRcpp(StringVector text, std::string sys_dic, std::string user_dic) {
+List posApplyRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create()) {
 
-  std::string args = "";
-  if (sys_dic != "") {
-    args.append(" -d ");
-    args.append(sys_dic);
-  }
-  if (user_dic != "") {
-    args.append(" -u ");
-    args.append(user_dic);
-  }
-
-  // lattice model
-  mecab_model_t* model;
-  mecab_t* tagger;
-  mecab_lattice_t* lattice;
-  const mecab_node_t* node;
-
-  // create model
-  model = mecab_model_new2(args.c_str());
+  mecab_model_t* model = newModel(sys_dic, user_dic);
   if (!model) {
-    Rcerr << "model is NULL" << std::endl;
     return R_NilValue;
   }
 
-  tagger = mecab_model_new_tagger(model);
-  lattice = mecab_model_new_lattice(model);
-
-  String parsed_morph;
-  String parsed_tag;
-  List result;
-
-  std::function< StringVector(String) > func = [&](String elem) {
-
-    StringVector parsed_string;
-    StringVector parsed_tagset;
-
-    const std::string input = elem;
-    mecab_lattice_set_sentence(lattice, input.c_str());
-    mecab_parse_lattice(tagger, lattice);
-    node = mecab_lattice_get_bos_node(lattice);
-
-    for (; node; node = node->next) {
-      if (node->stat == MECAB_BOS_NODE)
-        ;
-      else if (node->stat == MECAB_EOS_NODE)
-        ;
-      else {
-        parsed_morph = std::string(node->surface).substr(0, node->length);
-        parsed_morph.set_encoding(CE_UTF8);
-
-        std::vector<std::string> features;
-        boost::split(features, node->feature, boost::is_any_of(","));
-
-        String parsed_tag = features[0];
-        parsed_tag.set_encoding(CE_UTF8);
-
-        parsed_string.push_back(parsed_morph);
-        parsed_tagset.push_back(parsed_tag);
-      }
-    }
-
-    parsed_string.names() = parsed_tagset;
-    return parsed_string;
-  };
+  TokenFilter token_filter(filter);
 
-  result = lapply(text, func);
+  Utf8Input utf8_input(text);
+  const std::vector<std::string>& input = utf8_input.texts();
 
-  StringVector result_name(text.size());
+  std::vector< std::vector < std::string > > results(input.size());
+  TextParse func(&input, results, model, token_filter);
+  func.run(0, input.size());
 
-  for (R_len_t h = 0; h < text.size(); ++h) {
-    String character_name = text[h];
-    character_name.set_encoding(CE_UTF8);
-    result_name[h] = character_name;
-  }
-
-  result.names() = result_name;
-
-  mecab_destroy(tagger);
-  mecab_lattice_destroy(lattice);
   mecab_model_destroy(model);
 
-  return result;
+  utf8_input.warn();
+
+  return tokenList(results, true, text);
 }
 
-//' Call POS Tagger via `lapply` and return a named list.
+//' Call POS Tagger in a loop on this thread and return a named list.
 //'
 //' @param text Character vector.
 //' @param sys_dic String scalar.
 //' @param user_dic String scalar.
+//' @param filter List of token filter settings.
 //' @return named list.
 //'
 //' @name posApplyJoinRcpp
@@ -122,93 +69,91 @@ List posApplyRcpp(StringVector text, std::string sys_dic, std::string user_dic)
 //
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::export]]
-List posApplyJoinRcpp(StringVector text, std::string sys_dic, std::string user_dic) {
+List posApplyJoinRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create()) {
 
-  std::string args = "";
-  if (sys_dic != "") {
-    args.append(" -d ");
-    args.append(sys_dic);
-  }
-  if (user_dic != "") {
-    args.append(" -u ");
-    args.append(user_dic);
-  }
-
-  // lattice model
-  mecab_model_t* model;
-  mecab_t* tagger;
-  mecab_lattice_t* lattice;
-  const mecab_node_t* node;
-
-  // create model
-  model = mecab_model_new2(args.c_str());
+  mecab_model_t* model = newModel(sys_dic, user_dic);
   if (!model) {
-    Rcerr << "model is NULL" << std::endl;
     return R_NilValue;
   }
 
-  tagger = mecab_model_new_tagger(model);
-  lattice = mecab_model_new_lattice(model);
+  TokenFilter token_filter(filter);
 
-  String parsed_morph;
-  String parsed_tag;
-  List result;
+  Utf8Input utf8_input(text);
+  const std::vector<std::string>& input = utf8_input.texts();
 
-  std::function< StringVector(String) > func = [&](String elem) {
+  std::vector< std::vector < std::string > > results(input.size());
+  TextParseJoin func(&input, results, model, token_filter);
+  func.run(0, input.size());
 
-    StringVector parsed_string;
+  mecab_model_destroy(model);
 
-    const std::string input = elem;
-    mecab_lattice_set_sentence(lattice, input.c_str());
-    mecab_parse_lattice(tagger, lattice);
-    node = mecab_lattice_get_bos_node(lattice);
+  utf8_input.warn();
 
-    for (; node; node = node->next) {
-      if (node->stat == MECAB_BOS_NODE)
-        ;
-      else if (node->stat == MECAB_EOS_NODE)
-        ;
-      else {
-        parsed_morph = std::string(node->surface).substr(0, node->length);
-        parsed_morph.push_back("/");
+  return tokenList(results, false, text);
+}
 
-        std::vector<std::string> features;
-        boost::split(features, node->feature, boost::is_any_of(","));
+//' Call POS Tagger in a loop on this thread and return a list of surfaces only.
+//'
+//' @param text Character vector.
+//' @param sys_dic String scalar.
+//' @param user_dic String scalar.
+//' @param filter List of token filter settings.
+//' @return named list of character vectors.
+//'
+//' @name posWakatiRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+List posWakatiRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create()) {
 
-        parsed_morph.push_back(features[0]);
-        parsed_morph.set_encoding(CE_UTF8);
+  mecab_model_t* model = newModel(sys_dic, user_dic);
+  if (!model) {
+    return R_NilValue;
+  }
 
-        parsed_string.push_back(parsed_morph);
-      }
-    }
+  TokenFilter token_filter(filter);
 
-    return parsed_string;
-  };
+  Utf8Input utf8_input(text);
+  const std::vector<std::string>& input = utf8_input.texts();
 
-  result = lapply(text, func);
+  std::vector< WakatiDoc > results(input.size());
+  TextParseWakati<false> func(&input, results, model, token_filter);
+  func.run(0, input.size());
 
-  StringVector result_name(text.size());
+  mecab_model_destroy(model);
 
-  for (R_len_t h = 0; h < text.size(); ++h) {
-    String character_name = text[h];
-    character_name.set_encoding(CE_UTF8);
-    result_name[h] = character_name;
+  // surfaces go straight from the buffer of each document to CHARSXPs
+  List result(input.size());
+  for (size_t k = 0; k < results.size(); ++k) {
+    const WakatiDoc& doc = results[k];
+    StringVector parsed_string(doc.ends.size());
+    int begin = 0;
+    for (size_t l = 0; l < doc.ends.size(); ++l) {
+      SET_STRING_ELT(parsed_string, l, Rf_mkCharLenCE(doc.surfaces.data() + begin, doc.ends[l] - begin, CE_UTF8));
+      begin = doc.ends[l];
+    }
+    result[k] = parsed_string;
   }
 
-  result.names() = result_name;
+  // names keep the encoding of the original text
+  result.names() = StringVector(text.begin(), text.end());
 
-  mecab_destroy(tagger);
-  mecab_lattice_destroy(lattice);
-  mecab_model_destroy(model);
+  utf8_input.warn();
 
   return result;
 }
 
-//' Call POS Tagger via loop and return a data.frame
+//' Call POS Tagger in a loop on this thread and return a data.frame
 //'
 //' @param text Character vector.
 //' @param sys_dic String scalar.
 //' @param user_dic String scalar.
+//' @param filter List of token filter settings.
+//' @param offset String scalar. "none", "byte" or "char".
+//' @param expand Logical. Expand mecab-ko-dic expressions into component rows.
+//' @param eojeol Logical. Add an `eojeol_id` column numbering whitespace-separated units.
 //' @return data.frame.
 //'
 //' @name posLoopDFRcpp
@@ -217,127 +162,37 @@ List posApplyJoinRcpp(StringVector text, std::string sys_dic, std::string user_d
 //
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::export]]
-DataFrame posLoopDFRcpp(StringVector text, std::string sys_dic, std::string user_dic) {
+DataFrame posLoopDFRcpp(StringVector text, std::string sys_dic, std::string user_dic, List filter = List::create(), std::string offset = "none", bool expand = false, bool eojeol = false) {
 
-  std::string args = "";
-  if (sys_dic != "") {
-    args.append(" -d ");
-    args.append(sys_dic);
-  }
-  if (user_dic != "") {
-    args.append(" -u ");
-    args.append(user_dic);
-  }
-
-  // lattice model
-  mecab_model_t* model;
-  mecab_t* tagger;
-  mecab_lattice_t* lattice;
-  const mecab_node_t* node;
-
-  // create model
-  model = mecab_model_new2(args.c_str());
+  mecab_model_t* model = newModel(sys_dic, user_dic);
   if (!model) {
-    Rcerr << "model is NULL" << std::endl;
     return R_NilValue;
   }
 
-  tagger = mecab_model_new_tagger(model);
-  lattice = mecab_model_new_lattice(model);
-
-  StringVector::iterator it;
-
-  IntegerVector doc_id;
-  IntegerVector sentence_id;
-  IntegerVector token_id;
-  StringVector token;
-  StringVector pos;
-  StringVector subtype;
-  StringVector analytic;
-
-  String token_t;
-  String pos_t;
-  String subtype_t;
-  String analytic_t;
-
-  int doc_number = 0;
-  int sentence_number = 1;
-  int token_number = 1;
-
-  for (it = text.begin(); it != text.end(); ++it) {
-
-    mecab_lattice_set_sentence(lattice, as<const char*>(*it));
-    mecab_parse_lattice(tagger, lattice);
-    node = mecab_lattice_get_bos_node(lattice);
-
-    for (; node; node = node->next) {
-      if (node->stat == MECAB_BOS_NODE)
-        ;
-      else if (node->stat == MECAB_EOS_NODE)
-        ;
-      else {
-        std::vector<std::string> features;
-        boost::split(features, node->feature, boost::is_any_of(","));
-
-        token_t = std::string(node->surface).substr(0, node->length);
-        pos_t = features[0];
-        subtype_t = features[1];
-        // For parsing unk-feature when using Japanese MeCab and IPA-dict.
-        if (features.size() > 7) {
-          analytic_t = features[7];
-        } else {
-          analytic_t = "*";
-        }
-
-        // if (subtype_t == "*") {
-        //   subtype_t = "";
-        // }
-        // if (analytic_t == "*") {
-        //   analytic_t = "";
-        // }
-
-        token_t.set_encoding(CE_UTF8);
-        pos_t.set_encoding(CE_UTF8);
-        subtype_t.set_encoding(CE_UTF8);
-        analytic_t.set_encoding(CE_UTF8);
-
-        // append token, pos, and subtype
-        token.push_back(token_t);
-        pos.push_back(pos_t);
-        subtype.push_back(subtype_t);
-        analytic.push_back(analytic_t);
-
-        token_id.push_back(token_number);
-        token_number++;
-
-        // append sentence_id and token_id
-        sentence_id.push_back(sentence_number);
-        if (token_t == "." or token_t == "。") {
-          sentence_number++;
-          token_number = 1;
-        }
-
-        // append doc_id
-        doc_id.push_back(doc_number + 1);
-      }
-    }
-    sentence_number = 1;
-    token_number = 1;
-    doc_number++;
-  }
+  // feature columns depend on the system dictionary
+  const DicSchema schema = detectDicSchema(model);
+  const TokenOffset::Mode offset_mode = TokenOffset::parseMode(offset);
+
+  TokenFilter token_filter(filter);
+
+  Utf8Input utf8_input(text);
+  const std::vector<std::string>& input = utf8_input.texts();
+
+  std::vector< std::vector < std::string > > results(input.size());
+  std::vector< std::vector < int > > ids(input.size());
+  std::vector< std::vector < int > > spans(input.size());
+  std::vector< std::vector < int > > parents(input.size());
+  std::vector< std::vector < int > > eojeols(input.size());
+  TextParseDF func(&input, results, ids, model, token_filter, schema,
+                   offset_mode != TokenOffset::NONE ? &spans : NULL, offset_mode, expand ? &parents : NULL,
+                   eojeol ? &eojeols : NULL);
+  func.run(0, input.size());
 
-  mecab_destroy(tagger);
-  mecab_lattice_destroy(lattice);
   mecab_model_destroy(model);
 
-  return DataFrame::create(
-    _["doc_id"] = doc_id,
-    _["sentence_id"] = sentence_id,
-    _["token_id"] = token_id,
-    _["token"] = token,
-    _["pos"] = pos,
-    _["subtype"] = subtype,
-    _["analytic"] = analytic
-  );
-}
+  utf8_input.warn();
 
+  return tokenDataFrame(results, ids, schema.columns,
+                        offset_mode != TokenOffset::NONE ? &spans : NULL,
+                        expand ? &parents : NULL, eojeol ? &eojeols : NULL);
+}
@@ -0,0 +1,66 @@
+#ifndef RCPPMECAB_POSTABLE_H
+#define RCPPMECAB_POSTABLE_H
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "../inst/include/mecab.h"
+
+// POS tags (the first feature field) numbered in order of first sight and
+// looked up by `node->posid`, so a tag is cut out of the feature string only
+// the first time its posid appears. Dictionaries without a pos-id.def give
+// every node the same posid, so the cached tag is checked against the start
+// of the feature, which costs a compare instead of a scan for the comma.
+// Each thread keeps its own table in its copy of the parse policy (see
+// parseKernel.h), built once per parse call; it is not thread-safe.
+class PosTable
+{
+public:
+  PosTable() {}
+
+  size_t index(const mecab_node_t* node) {
+    const size_t posid = node->posid;
+    if (posid < by_posid_.size() && by_posid_[posid] < names_.size()) {
+      const std::string& name = names_[by_posid_[posid]];
+      // a match means the feature is at least as long as the name
+      if (std::strncmp(name.data(), node->feature, name.size()) == 0 &&
+          (node->feature[name.size()] == ',' || node->feature[name.size()] == '\0')) {
+        return by_posid_[posid];
+      }
+    }
+
+    const char* comma = std::strchr(node->feature, ',');
+    key_.assign(node->feature, comma ? static_cast<size_t>(comma - node->feature) : std::strlen(node->feature));
+    std::unordered_map<std::string, size_t>::iterator found = index_.find(key_);
+    if (found == index_.end()) {
+      found = index_.insert(std::make_pair(key_, names_.size())).first;
+      names_.push_back(key_);
+    }
+    if (posid >= by_posid_.size()) {
+      by_posid_.resize(posid + 1, static_cast<size_t>(-1));
+    }
+    by_posid_[posid] = found->second;
+    return found->second;
+  }
+
+  const std::string& pos(const mecab_node_t* node) {
+    return names_[index(node)];
+  }
+
+  const std::string& name(size_t index) const {
+    return names_[index];
+  }
+
+  size_t size() const {
+    return names_.size();
+  }
+
+private:
+  std::vector<std::string> names_;
+  std::unordered_map<std::string, size_t> index_;
+  std::vector<size_t> by_posid_;
+  std::string key_;
+};
+
+#endif
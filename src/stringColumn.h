@@ -0,0 +1,54 @@
+#ifndef RCPPMECAB_STRINGCOLUMN_H
+#define RCPPMECAB_STRINGCOLUMN_H
+
+#include <Rcpp.h>
+#include <string>
+#include <vector>
+
+// Convert parsed strings to a UTF-8 marked character vector in one allocation.
+inline Rcpp::StringVector makeStringColumn(const std::vector<std::string>& values) {
+  Rcpp::StringVector column(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    SET_STRING_ELT(column, i, Rf_mkCharLenCE(values[i].data(), static_cast<int>(values[i].size()), CE_UTF8));
+  }
+  return column;
+}
+
+inline SEXP makeUtf8Char(const std::string& value) {
+  return Rf_mkCharLenCE(value.data(), static_cast<int>(value.size()), CE_UTF8);
+}
+
+// List of the morphemes of each document, named by the original text.
+// `tagged` results alternate morphemes and tags, and the tags become names.
+inline Rcpp::List tokenList(const std::vector< std::vector < std::string > >& results, bool tagged, Rcpp::StringVector text) {
+  Rcpp::List result(results.size());
+  for (size_t k = 0; k < results.size(); ++k) {
+    const std::vector<std::string>& parsed = results[k];
+    if (!tagged) {
+      result[k] = makeStringColumn(parsed);
+    } else {
+      Rcpp::CharacterVector resultString(parsed.size() / 2);
+      Rcpp::CharacterVector resultTag(parsed.size() / 2);
+      for (size_t l = 0; l + 1 < parsed.size(); l += 2) {
+        SET_STRING_ELT(resultString, l / 2, makeUtf8Char(parsed[l]));
+        SET_STRING_ELT(resultTag, l / 2, makeUtf8Char(parsed[l + 1]));
+      }
+      resultString.names() = resultTag;
+      result[k] = resultString;
+    }
+  }
+
+  // names keep the encoding of the original text
+  result.names() = Rcpp::StringVector(text.begin(), text.end());
+  return result;
+}
+
+// Assemble a data.frame from named columns without going through
+// `as.data.frame()`, so character columns never become factors.
+inline Rcpp::DataFrame makeDataFrame(Rcpp::List columns, R_xlen_t nrows) {
+  columns.attr("class") = "data.frame";
+  columns.attr("row.names") = Rcpp::IntegerVector::create(NA_INTEGER, -static_cast<int>(nrows));
+  return Rcpp::DataFrame(columns);
+}
+
+#endif
@@ -0,0 +1,338 @@
+#ifndef RCPPMECAB_TEXTNORMALIZER_H
+#define RCPPMECAB_TEXTNORMALIZER_H
+
+#include <string>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include "../inst/include/mecab.h"
+
+// Source byte range of every byte of a normalized text, to map token
+// offsets back to the original text.
+struct NormalizeMap
+{
+  std::vector<boost::uint32_t> begin;
+  std::vector<boost::uint32_t> end;
+};
+
+// Normalizes text before parsing, in the workers. "width" folds the width
+// variants that NFKC folds: full-width ASCII and the ideographic space to
+// ASCII, half-width katakana to full-width (composing voiced marks).
+// "neologd" applies the rule set recommended for mecab-ipadic-NEologd:
+// width folding of alphanumerics and katakana, unified hyphens, long
+// vowels and tildes, and removal of spaces next to Japanese text.
+class TextNormalizer
+{
+public:
+  enum Mode { NONE, WIDTH, NEOLOGD };
+
+  static Mode parseMode(const std::string& mode) {
+    if (mode == "width") {
+      return WIDTH;
+    } else if (mode == "neologd") {
+      return NEOLOGD;
+    }
+    return NONE;
+  }
+
+  explicit TextNormalizer(Mode mode = NONE)
+    : mode_(mode)
+  {}
+
+  bool active() const {
+    return mode_ != NONE;
+  }
+
+  // `text` should be valid UTF-8. `out` is reused by the caller.
+  void normalize(const std::string& text, std::string& out, NormalizeMap* map) const {
+    std::vector<Char> chars;
+    decode(text, chars);
+
+    if (mode_ == WIDTH) {
+      chars = foldWidth(chars, false);
+    } else if (mode_ == NEOLOGD) {
+      chars = strip(chars);
+      chars = foldWidth(chars, true);
+      chars = replaceRuns(chars, isHyphen, 0x2D);
+      chars = replaceRuns(chars, isLongVowel, 0x30FC);
+      chars = replaceRuns(chars, isTilde, 0x301C);
+      chars = toFullWidthSymbols(chars);
+      chars = removeExtraSpaces(chars);
+      chars = toHalfWidthSymbols(chars);
+    }
+
+    encode(chars, out, map);
+  }
+
+private:
+
+  struct Char
+  {
+    boost::uint32_t cp;
+    boost::uint32_t begin;
+    boost::uint32_t end;
+  };
+
+  static void decode(const std::string& text, std::vector<Char>& chars) {
+    chars.reserve(text.size());
+    const unsigned char* s = reinterpret_cast<const unsigned char*>(text.data());
+    const size_t n = text.size();
+    size_t i = 0;
+    while (i < n) {
+      Char c;
+      c.begin = static_cast<boost::uint32_t>(i);
+      size_t len = 1;
+      if (s[i] < 0x80) {
+        c.cp = s[i];
+      } else if (s[i] < 0xE0) {
+        c.cp = s[i] & 0x1F;
+        len = 2;
+      } else if (s[i] < 0xF0) {
+        c.cp = s[i] & 0x0F;
+        len = 3;
+      } else {
+        c.cp = s[i] & 0x07;
+        len = 4;
+      }
+      for (size_t k = 1; k < len && i + k < n; ++k) {
+        c.cp = (c.cp << 6) | (s[i + k] & 0x3F);
+      }
+      i += len;
+      c.end = static_cast<boost::uint32_t>(i < n ? i : n);
+      chars.push_back(c);
+    }
+  }
+
+  static void encode(const std::vector<Char>& chars, std::string& out, NormalizeMap* map) {
+    out.clear();
+    if (map) {
+      map->begin.clear();
+      map->end.clear();
+    }
+    for (size_t i = 0; i < chars.size(); ++i) {
+      const boost::uint32_t cp = chars[i].cp;
+      const size_t before = out.size();
+      if (cp < 0x80) {
+        out.push_back(static_cast<char>(cp));
+      } else if (cp < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+      } else if (cp < 0x10000) {
+        out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+      } else {
+        out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+      }
+      if (map) {
+        map->begin.insert(map->begin.end(), out.size() - before, chars[i].begin);
+        map->end.insert(map->end.end(), out.size() - before, chars[i].end);
+      }
+    }
+  }
+
+  static bool isSpace(boost::uint32_t cp) {
+    return cp == 0x20 || cp == 0x3000 || (cp >= 0x09 && cp <= 0x0D);
+  }
+
+  static std::vector<Char> strip(const std::vector<Char>& chars) {
+    size_t first = 0, last = chars.size();
+    while (first < last && isSpace(chars[first].cp)) first++;
+    while (last > first && isSpace(chars[last - 1].cp)) last--;
+    return std::vector<Char>(chars.begin() + first, chars.begin() + last);
+  }
+
+  // half-width katakana U+FF61 to U+FF9F in full width
+  static boost::uint32_t fullWidthKana(boost::uint32_t cp) {
+    static const boost::uint16_t table[] = {
+      0x3002, 0x300C, 0x300D, 0x3001, 0x30FB, 0x30F2, 0x30A1, 0x30A3,
+      0x30A5, 0x30A7, 0x30A9, 0x30E3, 0x30E5, 0x30E7, 0x30C3, 0x30FC,
+      0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD, 0x30AF,
+      0x30B1, 0x30B3, 0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD, 0x30BF,
+      0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC, 0x30CD,
+      0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE, 0x30DF,
+      0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9, 0x30EA,
+      0x30EB, 0x30EC, 0x30ED, 0x30EF, 0x30F3, 0x3099, 0x309A
+    };
+    return table[cp - 0xFF61];
+  }
+
+  // katakana with a voiced (U+3099) or semi-voiced (U+309A) mark, or 0
+  static boost::uint32_t composeKana(boost::uint32_t base, boost::uint32_t mark) {
+    const bool ka_to = (base >= 0x30AB && base <= 0x30C2 && base % 2 == 1) ||
+                       base == 0x30C4 || base == 0x30C6 || base == 0x30C8;
+    const bool ha_ho = base >= 0x30CF && base <= 0x30DB && (base - 0x30CF) % 3 == 0;
+    if (mark == 0x3099) {
+      if (ka_to || ha_ho) return base + 1;
+      if (base == 0x30A6) return 0x30F4;
+      if (base == 0x30EF) return 0x30F7;
+      if (base == 0x30F2) return 0x30FA;
+    } else if (mark == 0x309A && ha_ho) {
+      return base + 2;
+    }
+    return 0;
+  }
+
+  // `alnum_only` restricts folding to the NEologd ranges: full-width
+  // alphanumerics and half-width katakana.
+  static std::vector<Char> foldWidth(const std::vector<Char>& chars, bool alnum_only) {
+    std::vector<Char> out;
+    out.reserve(chars.size());
+    for (size_t i = 0; i < chars.size(); ++i) {
+      Char c = chars[i];
+      const boost::uint32_t cp = c.cp;
+      const bool alnum = (cp >= 0xFF10 && cp <= 0xFF19) || (cp >= 0xFF21 && cp <= 0xFF3A) || (cp >= 0xFF41 && cp <= 0xFF5A);
+      if (cp >= 0xFF61 && cp <= 0xFF9F) {
+        c.cp = fullWidthKana(cp);
+        if ((c.cp == 0x3099 || c.cp == 0x309A) && !out.empty()) {
+          const boost::uint32_t composed = composeKana(out.back().cp, c.cp);
+          if (composed) {
+            out.back().cp = composed;
+            out.back().end = c.end;
+            continue;
+          }
+        }
+      } else if (alnum || (!alnum_only && cp >= 0xFF01 && cp <= 0xFF5E)) {
+        c.cp = cp - 0xFF01 + 0x21;
+      } else if (!alnum_only && cp == 0x3000) {
+        c.cp = 0x20;
+      } else if (!alnum_only && cp >= 0xFFE0 && cp <= 0xFFE6) {
+        static const boost::uint16_t signs[] = {0x00A2, 0x00A3, 0x00AC, 0x00AF, 0x00A6, 0x00A5, 0x20A9};
+        c.cp = signs[cp - 0xFFE0];
+      }
+      out.push_back(c);
+    }
+    return out;
+  }
+
+  static bool isHyphen(boost::uint32_t cp) {
+    return cp == 0x02D7 || cp == 0x058A || (cp >= 0x2010 && cp <= 0x2013) ||
+           cp == 0x2043 || cp == 0x207B || cp == 0x208B || cp == 0x2212;
+  }
+
+  static bool isLongVowel(boost::uint32_t cp) {
+    return cp == 0xFE63 || cp == 0xFF0D || cp == 0xFF70 || cp == 0x2014 || cp == 0x2015 ||
+           cp == 0x2500 || cp == 0x2501 || cp == 0x30FC;
+  }
+
+  static bool isTilde(boost::uint32_t cp) {
+    return cp == 0x7E || cp == 0x223C || cp == 0x223E || cp == 0x301C || cp == 0x3030 || cp == 0xFF5E;
+  }
+
+  // Replace each run of characters matching `match` by one `cp`.
+  static std::vector<Char> replaceRuns(const std::vector<Char>& chars, bool (*match)(boost::uint32_t), boost::uint32_t cp) {
+    std::vector<Char> out;
+    out.reserve(chars.size());
+    for (size_t i = 0; i < chars.size(); ++i) {
+      if (!match(chars[i].cp)) {
+        out.push_back(chars[i]);
+      } else if (i > 0 && match(chars[i - 1].cp)) {
+        out.back().end = chars[i].end;
+      } else {
+        Char c = chars[i];
+        c.cp = cp;
+        out.push_back(c);
+      }
+    }
+    return out;
+  }
+
+  static const char* asciiSymbols() {
+    return "!\"#$%&'()*+,-./:;<=>?@[]^_`{|}";
+  }
+
+  // ASCII symbols to full width; "\"" and "'" become U+201D and U+2019
+  static std::vector<Char> toFullWidthSymbols(const std::vector<Char>& chars) {
+    std::vector<Char> out(chars);
+    const std::string symbols = asciiSymbols();
+    for (size_t i = 0; i < out.size(); ++i) {
+      const boost::uint32_t cp = out[i].cp;
+      if (cp == 0x22) {
+        out[i].cp = 0x201D;
+      } else if (cp == 0x27) {
+        out[i].cp = 0x2019;
+      } else if (cp == 0xA5) {
+        out[i].cp = 0xFFE5;
+      } else if (cp < 0x80 && symbols.find(static_cast<char>(cp)) != std::string::npos) {
+        out[i].cp = cp - 0x21 + 0xFF01;
+      }
+    }
+    return out;
+  }
+
+  // Back to ASCII, except U+FF1D (full-width "=") which NEologd keeps.
+  static std::vector<Char> toHalfWidthSymbols(const std::vector<Char>& chars) {
+    std::vector<Char> out(chars);
+    const std::string symbols = asciiSymbols();
+    for (size_t i = 0; i < out.size(); ++i) {
+      const boost::uint32_t cp = out[i].cp;
+      if (cp == 0x201D) {
+        out[i].cp = 0x22;
+      } else if (cp == 0x2019) {
+        out[i].cp = 0x27;
+      } else if (cp == 0xFFE5) {
+        out[i].cp = 0xA5;
+      } else if (cp >= 0xFF01 && cp <= 0xFF5E && cp != 0xFF1D &&
+                 symbols.find(static_cast<char>(cp - 0xFF01 + 0x21)) != std::string::npos) {
+        out[i].cp = cp - 0xFF01 + 0x21;
+      }
+    }
+    return out;
+  }
+
+  static bool isJapaneseBlock(boost::uint32_t cp) {
+    return (cp >= 0x4E00 && cp <= 0x9FFF) || (cp >= 0x3000 && cp <= 0x30FF) || (cp >= 0xFF00 && cp <= 0xFFEF);
+  }
+
+  // Collapse spaces and drop those next to Japanese text, keeping the ones
+  // between two ASCII words.
+  static std::vector<Char> removeExtraSpaces(const std::vector<Char>& chars) {
+    std::vector<Char> collapsed;
+    collapsed.reserve(chars.size());
+    for (size_t i = 0; i < chars.size(); ++i) {
+      const bool space = chars[i].cp == 0x20 || chars[i].cp == 0x3000;
+      if (space && !collapsed.empty() && collapsed.back().cp == 0x20) {
+        collapsed.back().end = chars[i].end;
+        continue;
+      }
+      collapsed.push_back(chars[i]);
+      if (space) {
+        collapsed.back().cp = 0x20;
+      }
+    }
+
+    std::vector<Char> out;
+    out.reserve(collapsed.size());
+    for (size_t i = 0; i < collapsed.size(); ++i) {
+      if (collapsed[i].cp == 0x20 && !out.empty() && i + 1 < collapsed.size()) {
+        const boost::uint32_t prev = out.back().cp;
+        const boost::uint32_t next = collapsed[i + 1].cp;
+        const bool prev_ja = isJapaneseBlock(prev);
+        const bool next_ja = isJapaneseBlock(next);
+        if ((prev_ja && (next_ja || next < 0x80)) || (prev < 0x80 && next_ja)) {
+          continue;
+        }
+      }
+      out.push_back(collapsed[i]);
+    }
+    return out;
+  }
+
+  Mode mode_;
+};
+
+// Set the sentence of `lattice`, normalized into the worker's `buffer` when
+// `normalizer` is active. `map` receives the source ranges if given.
+inline void setLatticeSentence(mecab_lattice_t* lattice, const std::string& text, const TextNormalizer& normalizer,
+                               std::string& buffer, NormalizeMap* map = NULL) {
+  if (normalizer.active()) {
+    normalizer.normalize(text, buffer, map);
+    mecab_lattice_set_sentence2(lattice, buffer.data(), buffer.size());
+  } else {
+    mecab_lattice_set_sentence2(lattice, text.data(), text.size());
+  }
+}
+
+#endif
@@ -0,0 +1,147 @@
+#ifndef RCPPMECAB_TOKENFILTER_H
+#define RCPPMECAB_TOKENFILTER_H
+
+#include <Rcpp.h>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <unordered_set>
+#include "../inst/include/mecab.h"
+
+// Token predicate compiled once from the R-side filter list and evaluated
+// against each node before anything is copied out of the lattice.
+class TokenFilter
+{
+public:
+
+  // Per-worker scratch space. The POS decision is cached by `posid`; the
+  // cached tag is compared against the feature prefix, so dictionaries
+  // without a `pos-id.def` (every posid is 0) stay correct.
+  struct State
+  {
+    struct Entry
+    {
+      Entry() : known(false), accept(false) {}
+      bool known;
+      bool accept;
+      std::string pos;
+    };
+
+    std::vector<Entry> by_posid;
+    std::string buffer;
+  };
+
+  TokenFilter() : min_len_(0), max_len_(-1), active_(false) {}
+
+  explicit TokenFilter(Rcpp::List filter) : min_len_(0), max_len_(-1), active_(false) {
+    std::vector<std::string> values;
+
+    if (filter.containsElementNamed("keep_pos")) {
+      values = Rcpp::as< std::vector<std::string> >(filter["keep_pos"]);
+      keep_pos_.insert(values.begin(), values.end());
+    }
+    if (filter.containsElementNamed("drop_pos")) {
+      values = Rcpp::as< std::vector<std::string> >(filter["drop_pos"]);
+      drop_pos_.insert(values.begin(), values.end());
+    }
+    if (filter.containsElementNamed("stopwords")) {
+      values = Rcpp::as< std::vector<std::string> >(filter["stopwords"]);
+      stopwords_.insert(values.begin(), values.end());
+    }
+    if (filter.containsElementNamed("min_len")) {
+      min_len_ = Rcpp::as<int>(filter["min_len"]);
+    }
+    if (filter.containsElementNamed("max_len")) {
+      max_len_ = Rcpp::as<int>(filter["max_len"]);
+    }
+
+    updateActive();
+  }
+
+  // Same settings without R objects, for threads that cannot call R.
+  TokenFilter(const std::vector<std::string>& keep_pos, const std::vector<std::string>& drop_pos,
+              const std::vector<std::string>& stopwords, int min_len, int max_len)
+    : keep_pos_(keep_pos.begin(), keep_pos.end()), drop_pos_(drop_pos.begin(), drop_pos.end()),
+      stopwords_(stopwords.begin(), stopwords.end()), min_len_(min_len), max_len_(max_len), active_(false)
+  {
+    updateActive();
+  }
+
+  bool active() const { return active_; }
+
+  bool accept(const mecab_node_t* node, State& state) const {
+    if (!active_) {
+      return true;
+    }
+    if ((!keep_pos_.empty() || !drop_pos_.empty()) && !acceptPos(node, state)) {
+      return false;
+    }
+    if (min_len_ > 0 || max_len_ >= 0) {
+      const int n_chars = countChars(node->surface, node->length);
+      if (n_chars < min_len_ || (max_len_ >= 0 && n_chars > max_len_)) {
+        return false;
+      }
+    }
+    if (!stopwords_.empty()) {
+      state.buffer.assign(node->surface, node->length);
+      if (stopwords_.count(state.buffer) > 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+
+  void updateActive() {
+    active_ = !keep_pos_.empty() || !drop_pos_.empty() || !stopwords_.empty() ||
+      min_len_ > 0 || max_len_ >= 0;
+  }
+
+  bool acceptPos(const mecab_node_t* node, State& state) const {
+    const char* feature = node->feature;
+    const char* comma = std::strchr(feature, ',');
+    const size_t pos_len = comma ? static_cast<size_t>(comma - feature) : std::strlen(feature);
+
+    if (node->posid >= state.by_posid.size()) {
+      state.by_posid.resize(node->posid + 1);
+    }
+    State::Entry& entry = state.by_posid[node->posid];
+    if (entry.known && entry.pos.size() == pos_len &&
+        std::memcmp(entry.pos.data(), feature, pos_len) == 0) {
+      return entry.accept;
+    }
+
+    entry.pos.assign(feature, pos_len);
+    entry.accept = (keep_pos_.empty() || keep_pos_.count(entry.pos) > 0) &&
+      drop_pos_.count(entry.pos) == 0;
+    entry.known = true;
+    return entry.accept;
+  }
+
+  static int countChars(const char* surface, size_t length) {
+    int n = 0;
+    for (size_t i = 0; i < length; ++i) {
+      if ((static_cast<unsigned char>(surface[i]) & 0xC0) != 0x80) {
+        n++;
+      }
+    }
+    return n;
+  }
+
+  std::unordered_set<std::string> keep_pos_;
+  std::unordered_set<std::string> drop_pos_;
+  std::unordered_set<std::string> stopwords_;
+  int min_len_;
+  int max_len_;
+  bool active_;
+};
+
+// Sentence boundaries follow the surface, so they are still detected on
+// tokens rejected by the filter.
+inline bool isSentenceEnd(const mecab_node_t* node) {
+  return (node->length == 1 && node->surface[0] == '.') ||
+    (node->length == 3 && std::strncmp(node->surface, "\xE3\x80\x82", 3) == 0);
+}
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef RCPPMECAB_TOKENOFFSET_H
+#define RCPPMECAB_TOKENOFFSET_H
+
+#include <string>
+#include "../inst/include/mecab.h"
+#include "textNormalizer.h"
+
+// Locates node surfaces in the parsed text. `node->surface` points into the
+// sentence of the lattice, so the byte offset is a pointer difference; the
+// character offset is counted incrementally, since nodes come in order.
+// For normalized text, offsets are mapped back to the original text.
+class TokenOffset
+{
+public:
+  enum Mode { NONE, BYTE, CHAR };
+
+  static Mode parseMode(const std::string& mode) {
+    if (mode == "byte") {
+      return BYTE;
+    } else if (mode == "char") {
+      return CHAR;
+    }
+    return NONE;
+  }
+
+  explicit TokenOffset(Mode mode)
+    : mode_(mode), sentence_(NULL), text_(NULL), map_(NULL), byte_(0), char_(0)
+  {}
+
+  bool active() const {
+    return mode_ != NONE;
+  }
+
+  // Call after parsing each text. `original` and `map` are given when the
+  // lattice holds the normalized text.
+  void reset(mecab_lattice_t* lattice, const std::string* original = NULL, const NormalizeMap* map = NULL) {
+    sentence_ = mecab_lattice_get_sentence(lattice);
+    text_ = original ? original->c_str() : sentence_;
+    map_ = original ? map : NULL;
+    byte_ = 0;
+    char_ = 0;
+  }
+
+  // 1-based start and inclusive end of the surface, as in `stringi::stri_sub()`.
+  void locate(const mecab_node_t* node, int& start, int& end) {
+    size_t begin = static_cast<size_t>(node->surface - sentence_);
+    size_t last = begin + node->length;
+    if (map_ && node->length > 0) {
+      last = map_->end[last - 1];
+      begin = map_->begin[begin];
+    }
+    if (mode_ == BYTE) {
+      start = static_cast<int>(begin + 1);
+      end = static_cast<int>(last);
+      return;
+    }
+    advance(begin);
+    start = static_cast<int>(char_ + 1);
+    advance(last);
+    end = static_cast<int>(char_);
+  }
+
+private:
+
+  // count UTF-8 lead bytes up to `byte`
+  void advance(size_t byte) {
+    for (; byte_ < byte; ++byte_) {
+      if ((static_cast<unsigned char>(text_[byte_]) & 0xC0) != 0x80) {
+        char_++;
+      }
+    }
+  }
+
+  Mode mode_;
+  const char* sentence_;
+  const char* text_;
+  const NormalizeMap* map_;
+  size_t byte_;
+  size_t char_;
+};
+
+#endif
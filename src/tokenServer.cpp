@@ -0,0 +1,504 @@
+// [[Rcpp::plugins(cpp11)]]
+// [[Rcpp::depends(BH)]]
+
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <boost/cstdint.hpp>
+#include "tokenServer.h"
+
+#ifndef _WIN32
+#include <cerrno>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace tokenserver
+{
+
+class Encoder
+{
+public:
+  explicit Encoder(std::string& out) : out_(out) {}
+
+  void u8(int value) { out_.push_back(static_cast<char>(value)); }
+  void u32(boost::uint32_t value) { out_.append(reinterpret_cast<const char*>(&value), sizeof(value)); }
+  void i32(boost::int32_t value) { out_.append(reinterpret_cast<const char*>(&value), sizeof(value)); }
+
+  void string(const std::string& value) {
+    u32(static_cast<boost::uint32_t>(value.size()));
+    out_.append(value);
+  }
+
+  void strings(const std::vector<std::string>& values) {
+    u32(static_cast<boost::uint32_t>(values.size()));
+    for (size_t i = 0; i < values.size(); ++i) {
+      string(values[i]);
+    }
+  }
+
+  void ints(const std::vector<int>& values) {
+    u32(static_cast<boost::uint32_t>(values.size()));
+    for (size_t i = 0; i < values.size(); ++i) {
+      i32(values[i]);
+    }
+  }
+
+private:
+  std::string& out_;
+};
+
+// Throws std::runtime_error on a truncated payload.
+class Decoder
+{
+public:
+  explicit Decoder(const std::string& in) : in_(in), pos_(0) {}
+
+  int u8() {
+    need(1);
+    return static_cast<unsigned char>(in_[pos_++]);
+  }
+
+  boost::uint32_t u32() {
+    boost::uint32_t value;
+    read(&value, sizeof(value));
+    return value;
+  }
+
+  boost::int32_t i32() {
+    boost::int32_t value;
+    read(&value, sizeof(value));
+    return value;
+  }
+
+  void string(std::string& value) {
+    const boost::uint32_t n = u32();
+    need(n);
+    value.assign(in_, pos_, n);
+    pos_ += n;
+  }
+
+  void strings(std::vector<std::string>& values) {
+    const boost::uint32_t n = u32();
+    // every string takes at least its length
+    need(static_cast<size_t>(n) * sizeof(boost::uint32_t));
+    values.resize(n);
+    for (boost::uint32_t i = 0; i < n; ++i) {
+      string(values[i]);
+    }
+  }
+
+  void ints(std::vector<int>& values) {
+    const boost::uint32_t n = u32();
+    need(static_cast<size_t>(n) * sizeof(boost::int32_t));
+    values.resize(n);
+    for (boost::uint32_t i = 0; i < n; ++i) {
+      values[i] = i32();
+    }
+  }
+
+  void need(size_t n) const {
+    if (in_.size() - pos_ < n) {
+      throw std::runtime_error("truncated message");
+    }
+  }
+
+  void read(void* value, size_t n) {
+    need(n);
+    std::memcpy(value, in_.data() + pos_, n);
+    pos_ += n;
+  }
+
+private:
+  const std::string& in_;
+  size_t pos_;
+};
+
+static void encodeRequest(const Request& request, std::string& out) {
+  Encoder encoder(out);
+  encoder.u8(request.op);
+  if (request.op != PARSE) {
+    return;
+  }
+  encoder.string(request.format);
+  encoder.string(request.normalize);
+  encoder.strings(request.keep_pos);
+  encoder.strings(request.drop_pos);
+  encoder.strings(request.stopwords);
+  encoder.i32(request.min_len);
+  encoder.i32(request.max_len);
+  encoder.strings(request.texts);
+}
+
+static void decodeRequest(const std::string& in, Request& request) {
+  Decoder decoder(in);
+  request.op = decoder.u8();
+  if (request.op != PARSE) {
+    return;
+  }
+  decoder.string(request.format);
+  decoder.string(request.normalize);
+  decoder.strings(request.keep_pos);
+  decoder.strings(request.drop_pos);
+  decoder.strings(request.stopwords);
+  request.min_len = decoder.i32();
+  request.max_len = decoder.i32();
+  decoder.strings(request.texts);
+}
+
+static void encodeReply(const Reply& reply, std::string& out) {
+  Encoder encoder(out);
+  encoder.string(reply.error);
+  encoder.strings(reply.columns);
+  encoder.u32(static_cast<boost::uint32_t>(reply.results.size()));
+  for (size_t k = 0; k < reply.results.size(); ++k) {
+    encoder.strings(reply.results[k]);
+    encoder.ints(k < reply.ids.size() ? reply.ids[k] : std::vector<int>());
+  }
+}
+
+static void decodeReply(const std::string& in, Reply& reply) {
+  Decoder decoder(in);
+  decoder.string(reply.error);
+  decoder.strings(reply.columns);
+  const boost::uint32_t n = decoder.u32();
+  // every document takes at least two counts
+  decoder.need(static_cast<size_t>(n) * 2 * sizeof(boost::uint32_t));
+  reply.results.resize(n);
+  reply.ids.resize(n);
+  for (boost::uint32_t k = 0; k < n; ++k) {
+    decoder.strings(reply.results[k]);
+    decoder.ints(reply.ids[k]);
+  }
+}
+
+#ifndef _WIN32
+
+static bool sendAll(int fd, const char* data, size_t size) {
+#ifdef MSG_NOSIGNAL
+  const int flags = MSG_NOSIGNAL;
+#else
+  const int flags = 0;
+#endif
+  while (size > 0) {
+    const ssize_t n = ::send(fd, data, size, flags);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      return false;
+    }
+    data += n;
+    size -= static_cast<size_t>(n);
+  }
+  return true;
+}
+
+static bool receiveAll(int fd, char* data, size_t size) {
+  while (size > 0) {
+    const ssize_t n = ::recv(fd, data, size, 0);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      return false;
+    }
+    data += n;
+    size -= static_cast<size_t>(n);
+  }
+  return true;
+}
+
+static bool sendMessage(int fd, const char* magic, const std::string& payload) {
+  const boost::uint64_t size = payload.size();
+  return sendAll(fd, magic, 4) &&
+    sendAll(fd, reinterpret_cast<const char*>(&size), sizeof(size)) &&
+    sendAll(fd, payload.data(), payload.size());
+}
+
+// False on a closed connection or a message of another kind.
+static bool receiveHeader(int fd, const char* magic, boost::uint64_t& size) {
+  char head[4];
+  return receiveAll(fd, head, 4) && std::memcmp(head, magic, 4) == 0 &&
+    receiveAll(fd, reinterpret_cast<char*>(&size), sizeof(size));
+}
+
+// Also false on a payload larger than `max_size`, which is left unread.
+static bool receiveMessage(int fd, const char* magic, std::string& payload,
+                           boost::uint64_t max_size = MAX_MESSAGE_SIZE) {
+  boost::uint64_t size;
+  if (!receiveHeader(fd, magic, size) || size > max_size) {
+    return false;
+  }
+  payload.resize(static_cast<size_t>(size));
+  return size == 0 || receiveAll(fd, &payload[0], payload.size());
+}
+
+static bool makeAddress(const std::string& path, sockaddr_un& address) {
+  std::memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+    return false;
+  }
+  std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+  return true;
+}
+
+static void ignoreSigpipe(int fd) {
+#ifdef SO_NOSIGPIPE
+  int on = 1;
+  ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#else
+  (void) fd;
+#endif
+}
+
+// Blocking recv() and send() on `fd` fail with EAGAIN after `seconds`.
+static void setTimeout(int fd, int seconds) {
+  timeval timeout;
+  timeout.tv_sec = seconds;
+  timeout.tv_usec = 0;
+  ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  ::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+}
+
+// Connected socket, or -1.
+static int connectSocket(const std::string& path) {
+  sockaddr_un address;
+  if (!makeAddress(path, address)) {
+    return -1;
+  }
+  const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) {
+    return -1;
+  }
+  ignoreSigpipe(fd);
+  if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+    ::close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+bool sendFrame(const std::string& path, const std::string& frame, Reply& reply) {
+  const int fd = connectSocket(path);
+  if (fd < 0) {
+    return false;
+  }
+  std::string payload;
+  const bool ok = sendAll(fd, frame.data(), frame.size()) && receiveMessage(fd, "RMCR", payload);
+  ::close(fd);
+  if (ok) {
+    decodeReply(payload, reply);
+  }
+  return ok;
+}
+
+bool call(const std::string& path, const Request& request, Reply& reply) {
+  const int fd = connectSocket(path);
+  if (fd < 0) {
+    return false;
+  }
+  std::string payload;
+  encodeRequest(request, payload);
+  const bool ok = sendMessage(fd, "RMCQ", payload) && receiveMessage(fd, "RMCR", payload);
+  ::close(fd);
+  if (ok) {
+    decodeReply(payload, reply);
+  }
+  return ok;
+}
+
+struct Server::Impl
+{
+  Impl(const std::string& path, size_t threads, const Handler& handler)
+    : path_(path), handler_(handler), listener_(-1), stop_(false)
+  {
+    sockaddr_un address;
+    if (!makeAddress(path, address)) {
+      throw std::runtime_error("invalid socket path: " + path);
+    }
+    // a server left running answers on the path; a stale file does not
+    const int probe = connectSocket(path);
+    if (probe >= 0) {
+      ::close(probe);
+      throw std::runtime_error("a server is already listening on " + path);
+    }
+    ::unlink(path.c_str());
+
+    listener_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener_ < 0 ||
+        ::bind(listener_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(listener_, 64) != 0) {
+      const std::string reason = std::strerror(errno);
+      if (listener_ >= 0) ::close(listener_);
+      throw std::runtime_error("cannot listen on " + path + ": " + reason);
+    }
+
+    for (size_t i = 0; i < (threads > 0 ? threads : 1); ++i) {
+      workers_.push_back(std::thread([this] { work(); }));
+    }
+  }
+
+  ~Impl() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+      // wake up workers blocked on idle connections
+      for (std::set<int>::iterator it = active_.begin(); it != active_.end(); ++it) {
+        ::shutdown(*it, SHUT_RDWR);
+      }
+    }
+    ready_.notify_all();
+    for (size_t i = 0; i < workers_.size(); ++i) {
+      workers_[i].join();
+    }
+    for (size_t i = 0; i < pending_.size(); ++i) {
+      ::close(pending_[i]);
+    }
+    ::close(listener_);
+    ::unlink(path_.c_str());
+  }
+
+  void run(const std::function<void()>& check) {
+    while (!stop_) {
+      check();
+      pollfd listening;
+      listening.fd = listener_;
+      listening.events = POLLIN;
+      listening.revents = 0;
+      if (::poll(&listening, 1, 200) <= 0) {
+        continue;
+      }
+      const int fd = ::accept(listener_, NULL, NULL);
+      if (fd < 0) {
+        continue;
+      }
+      ignoreSigpipe(fd);
+      // an idle client would otherwise hold its worker forever
+      setTimeout(fd, IDLE_TIMEOUT);
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.push_back(fd);
+      }
+      ready_.notify_one();
+    }
+  }
+
+  void work() {
+    for (;;) {
+      int fd;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ready_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+        if (stop_) {
+          return;
+        }
+        fd = pending_.front();
+        pending_.pop_front();
+        active_.insert(fd);
+      }
+      try {
+        serve(fd);
+      } catch (std::exception&) {
+        // a broken client must not take the server thread down
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        active_.erase(fd);
+      }
+      ::close(fd);
+    }
+  }
+
+  void serve(int fd) {
+    std::string payload;
+    boost::uint64_t size;
+    while (!stop_ && receiveHeader(fd, "RMCQ", size)) {
+      Request request;
+      Reply reply;
+      if (size > MAX_REQUEST_SIZE) {
+        // the payload is not read, so the connection cannot go on
+        reply.error = "request too large";
+        payload.clear();
+        encodeReply(reply, payload);
+        sendMessage(fd, "RMCR", payload);
+        return;
+      }
+      payload.resize(static_cast<size_t>(size));
+      if (size > 0 && !receiveAll(fd, &payload[0], payload.size())) {
+        return;
+      }
+      try {
+        decodeRequest(payload, request);
+        if (request.op == SHUTDOWN) {
+          stop_ = true;
+        } else if (request.op == PARSE) {
+          handler_(request, reply);
+        } else {
+          reply.error = "unknown request";
+        }
+      } catch (std::exception& e) {
+        reply = Reply();
+        reply.error = e.what();
+      }
+      payload.clear();
+      encodeReply(reply, payload);
+      if (!sendMessage(fd, "RMCR", payload)) {
+        return;
+      }
+    }
+  }
+
+  std::string path_;
+  Handler handler_;
+  int listener_;
+  std::atomic<bool> stop_;
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  std::deque<int> pending_;
+  std::set<int> active_;
+  std::vector<std::thread> workers_;
+};
+
+Server::Server(const std::string& path, size_t threads, const Handler& handler)
+  : impl_(new Impl(path, threads, handler))
+{}
+
+Server::~Server() {}
+
+void Server::run(const std::function<void()>& check) {
+  impl_->run(check);
+}
+
+#else
+
+bool sendFrame(const std::string&, const std::string&, Reply&) {
+  return false;
+}
+
+bool call(const std::string&, const Request&, Reply&) {
+  return false;
+}
+
+struct Server::Impl {};
+
+Server::Server(const std::string&, size_t, const Handler&) {
+  throw std::runtime_error("the server is not available on Windows");
+}
+
+Server::~Server() {}
+
+void Server::run(const std::function<void()>&) {}
+
+#endif
+
+}
@@ -0,0 +1,88 @@
+#ifndef RCPPMECAB_TOKENSERVER_H
+#define RCPPMECAB_TOKENSERVER_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <boost/cstdint.hpp>
+
+// Local tokenization server on a Unix domain socket. Every message is a
+// 4-byte magic, a u64 payload length and the payload, in host byte order
+// since both ends are on the same host. Strings are a u32 length and bytes.
+//
+//   request "RMCQ": u8 op (1 parse, 2 shutdown); for parse, format,
+//                   normalize, keep_pos[], drop_pos[], stopwords[],
+//                   i32 min_len, i32 max_len, texts[]
+//   reply   "RMCR": error (empty on success), columns[], u32 n_docs, then
+//                   for each document strings[] and i32 ids[]
+//
+// A connection may send any number of requests, one reply each. A request
+// larger than MAX_REQUEST_SIZE gets an error reply and the connection is
+// closed without reading it. A connection that sends nothing, or does not
+// read its reply, for IDLE_TIMEOUT seconds is closed to free its worker.
+namespace tokenserver
+{
+
+static const boost::uint64_t MAX_REQUEST_SIZE = static_cast<boost::uint64_t>(1) << 30;
+static const boost::uint64_t MAX_MESSAGE_SIZE = static_cast<boost::uint64_t>(1) << 40;
+static const int IDLE_TIMEOUT = 60;
+
+enum Op { PARSE = 1, SHUTDOWN = 2 };
+
+struct Request
+{
+  Request() : op(PARSE), min_len(0), max_len(-1) {}
+
+  int op;
+  std::string format;
+  std::string normalize;
+  std::vector<std::string> keep_pos;
+  std::vector<std::string> drop_pos;
+  std::vector<std::string> stopwords;
+  int min_len;
+  int max_len;
+  std::vector<std::string> texts;
+};
+
+struct Reply
+{
+  std::string error;
+  std::vector<std::string> columns;
+  std::vector< std::vector<std::string> > results;
+  std::vector< std::vector<int> > ids;
+};
+
+// Send a request and wait for its reply. Returns false if the server cannot
+// be reached or closes the connection.
+bool call(const std::string& path, const Request& request, Reply& reply);
+
+// Send `frame` as it is and read the reply, to check how the server copes
+// with malformed messages. Returns false like `call()`.
+bool sendFrame(const std::string& path, const std::string& frame, Reply& reply);
+
+// Accepts connections on the calling thread and serves them on a fixed pool
+// of worker threads, so the model is loaded once for every client. The
+// threads are started in tokenServer.cpp, out of reach of RcppThread's
+// override of std::thread. Not available on Windows.
+class Server
+{
+public:
+  typedef std::function<void(const Request&, Reply&)> Handler;
+
+  // Throws std::runtime_error if the socket cannot be bound.
+  Server(const std::string& path, size_t threads, const Handler& handler);
+  ~Server();
+
+  // Accept connections until a client sends a shutdown request. `check` is
+  // called between polls and may throw to stop the server.
+  void run(const std::function<void()>& check);
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}
+
+#endif
@@ -0,0 +1,382 @@
+#ifndef RCPPMECAB_TOKENSTORE_H
+#define RCPPMECAB_TOKENSTORE_H
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <boost/cstdint.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+// Binary columnar file of a tokenized corpus.
+//
+// All strings (tokens, tags, feature columns, document names) share one
+// dictionary-encoded pool, and every string column is stored as 32-bit codes
+// into that pool. Sections are 8-byte aligned and laid out in this order:
+//
+//   header | column names | doc offsets (uint64, n_docs + 1)
+//   | doc names (uint32, n_docs, optional) | sentence_id (int32) | token_id (int32)
+//   | string columns (uint32 codes, n_columns x n_tokens)
+//   | pool offsets (uint64, n_strings + 1) | pool bytes
+//
+// Rows of document i are doc_offsets[i] to doc_offsets[i + 1] - 1.
+
+namespace tokenstore {
+
+static const char MAGIC[8] = {'R', 'M', 'C', 'T', 'O', 'K', '0', '1'};
+static const boost::uint32_t BYTE_ORDER_MARK = 0x01020304;
+static const boost::uint32_t NO_NAME = 0xFFFFFFFF;
+
+struct Header
+{
+  char magic[8];
+  boost::uint32_t byte_order;
+  boost::uint32_t n_columns;
+  boost::uint64_t n_docs;
+  boost::uint64_t n_tokens;
+  boost::uint64_t n_strings;
+  boost::uint64_t pool_bytes;
+  boost::uint32_t has_doc_names;
+  boost::uint32_t reserved;
+};
+
+inline boost::uint64_t align8(boost::uint64_t n) {
+  return (n + 7) & ~static_cast<boost::uint64_t>(7);
+}
+
+// Sizes read from a file may be anything, so the layout is computed with
+// arithmetic that throws instead of wrapping around.
+inline boost::uint64_t checkedAdd(boost::uint64_t a, boost::uint64_t b) {
+  if (b > static_cast<boost::uint64_t>(-1) - a) {
+    throw std::runtime_error("corrupt token file header");
+  }
+  return a + b;
+}
+
+inline boost::uint64_t checkedMul(boost::uint64_t a, boost::uint64_t b) {
+  if (a != 0 && b > static_cast<boost::uint64_t>(-1) / a) {
+    throw std::runtime_error("corrupt token file header");
+  }
+  return a * b;
+}
+
+inline boost::uint64_t checkedAlign8(boost::uint64_t n) {
+  return checkedAdd(n, 7) & ~static_cast<boost::uint64_t>(7);
+}
+
+// Byte offsets of every section, derived from the header and column names.
+struct Layout
+{
+  boost::uint64_t names;
+  boost::uint64_t doc_offsets;
+  boost::uint64_t doc_names;
+  boost::uint64_t sentence_id;
+  boost::uint64_t token_id;
+  boost::uint64_t columns;
+  boost::uint64_t pool_offsets;
+  boost::uint64_t pool;
+  boost::uint64_t end;
+
+  // Throws std::runtime_error if the sizes of the header overflow.
+  Layout(const Header& header, boost::uint64_t names_bytes) {
+    const boost::uint64_t column_bytes = checkedAlign8(checkedMul(header.n_tokens, sizeof(boost::uint32_t)));
+    names = align8(sizeof(Header));
+    doc_offsets = checkedAdd(names, checkedAlign8(names_bytes));
+    doc_names = checkedAdd(doc_offsets, checkedMul(checkedAdd(header.n_docs, 1), sizeof(boost::uint64_t)));
+    sentence_id = checkedAdd(doc_names, header.has_doc_names ? checkedAlign8(checkedMul(header.n_docs, sizeof(boost::uint32_t))) : 0);
+    token_id = checkedAdd(sentence_id, checkedAlign8(checkedMul(header.n_tokens, sizeof(boost::int32_t))));
+    columns = checkedAdd(token_id, checkedAlign8(checkedMul(header.n_tokens, sizeof(boost::int32_t))));
+    pool_offsets = checkedAdd(columns, checkedMul(header.n_columns, column_bytes));
+    pool = checkedAdd(pool_offsets, checkedMul(checkedAdd(header.n_strings, 1), sizeof(boost::uint64_t)));
+    end = checkedAdd(pool, header.pool_bytes);
+  }
+};
+
+// Accumulates documents and writes the file at once. Memory use is four
+// bytes per token and column, plus the distinct strings.
+class Writer
+{
+public:
+  explicit Writer(const std::vector<std::string>& columns)
+    : columns_(columns), codes_(columns.size()), has_doc_names_(false)
+  {
+    doc_offsets_.push_back(0);
+  }
+
+  // `fields` holds `columns.size()` strings per token and `ids` holds
+  // (sentence_id, token_id) pairs, as produced by the parse workers.
+  void addDocument(const std::vector<std::string>& fields, const std::vector<int>& ids, const std::string* name) {
+    const size_t stride = columns_.size();
+    for (size_t l = 0, t = 0; l + stride <= fields.size(); l += stride, ++t) {
+      for (size_t c = 0; c < stride; ++c) {
+        codes_[c].push_back(encode(fields[l + c]));
+      }
+      sentence_id_.push_back(ids[2 * t]);
+      token_id_.push_back(ids[2 * t + 1]);
+    }
+    doc_offsets_.push_back(sentence_id_.size());
+    if (name) {
+      has_doc_names_ = true;
+      doc_names_.push_back(encode(*name));
+    } else {
+      doc_names_.push_back(NO_NAME);
+    }
+  }
+
+  size_t nDocs() const { return doc_offsets_.size() - 1; }
+  size_t nTokens() const { return sentence_id_.size(); }
+
+  void write(const std::string& file) const {
+    std::ofstream out(file.c_str(), std::ios::binary | std::ios::trunc);
+    if (!out) {
+      throw std::runtime_error("cannot open " + file + " for writing");
+    }
+
+    std::string names;
+    for (size_t c = 0; c < columns_.size(); ++c) {
+      const boost::uint32_t len = static_cast<boost::uint32_t>(columns_[c].size());
+      names.append(reinterpret_cast<const char*>(&len), sizeof(len));
+      names.append(columns_[c]);
+    }
+
+    Header header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.byte_order = BYTE_ORDER_MARK;
+    header.n_columns = static_cast<boost::uint32_t>(columns_.size());
+    header.n_docs = nDocs();
+    header.n_tokens = nTokens();
+    header.n_strings = pool_.size();
+    header.pool_bytes = 0;
+    for (size_t s = 0; s < pool_.size(); ++s) {
+      header.pool_bytes += pool_[s].size();
+    }
+    header.has_doc_names = has_doc_names_ ? 1 : 0;
+    header.reserved = 0;
+
+    writeRaw(out, &header, sizeof(header));
+    pad(out);
+    writeRaw(out, names.data(), names.size());
+    pad(out);
+    writeVector(out, doc_offsets_);
+    if (has_doc_names_) {
+      writeVector(out, doc_names_);
+      pad(out);
+    }
+    writeVector(out, sentence_id_);
+    pad(out);
+    writeVector(out, token_id_);
+    pad(out);
+    for (size_t c = 0; c < codes_.size(); ++c) {
+      writeVector(out, codes_[c]);
+      pad(out);
+    }
+
+    std::vector<boost::uint64_t> pool_offsets(pool_.size() + 1, 0);
+    for (size_t s = 0; s < pool_.size(); ++s) {
+      pool_offsets[s + 1] = pool_offsets[s] + pool_[s].size();
+    }
+    writeVector(out, pool_offsets);
+    for (size_t s = 0; s < pool_.size(); ++s) {
+      writeRaw(out, pool_[s].data(), pool_[s].size());
+    }
+
+    if (!out) {
+      throw std::runtime_error("failed to write " + file);
+    }
+  }
+
+private:
+
+  boost::uint32_t encode(const std::string& value) {
+    std::unordered_map<std::string, boost::uint32_t>::iterator it = index_.find(value);
+    if (it != index_.end()) {
+      return it->second;
+    }
+    const boost::uint32_t code = static_cast<boost::uint32_t>(pool_.size());
+    index_.insert(std::make_pair(value, code));
+    pool_.push_back(value);
+    return code;
+  }
+
+  static void writeRaw(std::ofstream& out, const void* data, size_t bytes) {
+    out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+  }
+
+  template <typename T>
+  static void writeVector(std::ofstream& out, const std::vector<T>& values) {
+    if (!values.empty()) {
+      writeRaw(out, values.data(), values.size() * sizeof(T));
+    }
+  }
+
+  static void pad(std::ofstream& out) {
+    static const char zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    const boost::uint64_t pos = static_cast<boost::uint64_t>(out.tellp());
+    writeRaw(out, zeros, align8(pos) - pos);
+  }
+
+  std::vector<std::string> columns_;
+  std::vector< std::vector<boost::uint32_t> > codes_;
+  std::vector<boost::uint64_t> doc_offsets_;
+  std::vector<boost::uint32_t> doc_names_;
+  std::vector<boost::int32_t> sentence_id_;
+  std::vector<boost::int32_t> token_id_;
+  std::vector<std::string> pool_;
+  std::unordered_map<std::string, boost::uint32_t> index_;
+  bool has_doc_names_;
+};
+
+// Memory-maps a token file. Nothing is decoded until a column is requested.
+// Offsets are checked when the file is opened and codes by `checkCode()` as
+// they are read, so a corrupted file throws std::runtime_error instead of
+// reading out of the mapping, and reading a few documents costs no scan of
+// whole columns.
+class Reader
+{
+public:
+  explicit Reader(const std::string& file)
+    : file_(file),
+      mapping_(file.c_str(), boost::interprocess::read_only),
+      region_(mapping_, boost::interprocess::read_only)
+  {
+    base_ = static_cast<const char*>(region_.get_address());
+    const boost::uint64_t size = region_.get_size();
+
+    if (size < sizeof(Header)) {
+      throw std::runtime_error(file + " is not a token file");
+    }
+    std::memcpy(&header_, base_, sizeof(Header));
+    if (std::memcmp(header_.magic, MAGIC, sizeof(MAGIC)) != 0) {
+      throw std::runtime_error(file + " is not a token file");
+    }
+    if (header_.byte_order != BYTE_ORDER_MARK) {
+      throw std::runtime_error(file + " was written on a platform with another byte order");
+    }
+
+    boost::uint64_t pos = align8(sizeof(Header));
+    for (boost::uint32_t c = 0; c < header_.n_columns; ++c) {
+      boost::uint32_t len;
+      if (pos + sizeof(len) > size) {
+        throw std::runtime_error(file + " is truncated");
+      }
+      std::memcpy(&len, base_ + pos, sizeof(len));
+      pos += sizeof(len);
+      if (pos + len > size) {
+        throw std::runtime_error(file + " is truncated");
+      }
+      columns_.push_back(std::string(base_ + pos, len));
+      pos += len;
+    }
+
+    layout_ = new Layout(header_, pos - align8(sizeof(Header)));
+    try {
+      if (layout_->end > size) {
+        throw std::runtime_error(file + " is truncated");
+      }
+      validate();
+    } catch (...) {
+      delete layout_;
+      throw;
+    }
+  }
+
+  ~Reader() {
+    delete layout_;
+  }
+
+  const std::string& file() const { return file_; }
+  const std::vector<std::string>& columns() const { return columns_; }
+  size_t nDocs() const { return header_.n_docs; }
+  size_t nTokens() const { return header_.n_tokens; }
+  size_t nStrings() const { return header_.n_strings; }
+  bool hasDocNames() const { return header_.has_doc_names != 0; }
+
+  const boost::uint64_t* docOffsets() const {
+    return reinterpret_cast<const boost::uint64_t*>(base_ + layout_->doc_offsets);
+  }
+  const boost::uint32_t* docNames() const {
+    return reinterpret_cast<const boost::uint32_t*>(base_ + layout_->doc_names);
+  }
+  const boost::int32_t* sentenceId() const {
+    return reinterpret_cast<const boost::int32_t*>(base_ + layout_->sentence_id);
+  }
+  const boost::int32_t* tokenId() const {
+    return reinterpret_cast<const boost::int32_t*>(base_ + layout_->token_id);
+  }
+
+  // Codes of the string column at `index`; see `columns()`. They are not
+  // checked: pass each one read to `checkCode()` before using it.
+  const boost::uint32_t* codes(size_t index) const {
+    return reinterpret_cast<const boost::uint32_t*>(
+      base_ + layout_->columns + index * align8(header_.n_tokens * sizeof(boost::uint32_t)));
+  }
+
+  void checkCode(boost::uint32_t code) const {
+    if (code >= header_.n_strings) {
+      throw std::runtime_error(file_ + " is corrupted: code out of the string pool");
+    }
+  }
+
+  // String of a checked `code`.
+  const char* string(boost::uint32_t code, size_t& length) const {
+    const boost::uint64_t* offsets = poolOffsets();
+    length = offsets[code + 1] - offsets[code];
+    return base_ + layout_->pool + offsets[code];
+  }
+
+private:
+  Reader(const Reader&);
+  Reader& operator=(const Reader&);
+
+  const boost::uint64_t* poolOffsets() const {
+    return reinterpret_cast<const boost::uint64_t*>(base_ + layout_->pool_offsets);
+  }
+
+  // Offsets must start at 0, never decrease and end at the size they index,
+  // and document names must be in the pool.
+  void validate() const {
+    const boost::uint64_t* doc_offsets = docOffsets();
+    if (doc_offsets[0] != 0 || doc_offsets[header_.n_docs] != header_.n_tokens) {
+      throw std::runtime_error(file_ + " is corrupted: bad document offsets");
+    }
+    for (boost::uint64_t k = 0; k < header_.n_docs; ++k) {
+      if (doc_offsets[k] > doc_offsets[k + 1]) {
+        throw std::runtime_error(file_ + " is corrupted: bad document offsets");
+      }
+    }
+
+    const boost::uint64_t* pool_offsets = poolOffsets();
+    if (pool_offsets[0] != 0 || pool_offsets[header_.n_strings] != header_.pool_bytes) {
+      throw std::runtime_error(file_ + " is corrupted: bad string pool offsets");
+    }
+    for (boost::uint64_t s = 0; s < header_.n_strings; ++s) {
+      if (pool_offsets[s] > pool_offsets[s + 1]) {
+        throw std::runtime_error(file_ + " is corrupted: bad string pool offsets");
+      }
+    }
+
+    if (hasDocNames()) {
+      const boost::uint32_t* names = docNames();
+      for (boost::uint64_t k = 0; k < header_.n_docs; ++k) {
+        if (names[k] != NO_NAME && names[k] >= header_.n_strings) {
+          throw std::runtime_error(file_ + " is corrupted: document name out of the string pool");
+        }
+      }
+    }
+  }
+
+  std::string file_;
+  boost::interprocess::file_mapping mapping_;
+  boost::interprocess::mapped_region region_;
+  const char* base_;
+  Header header_;
+  Layout* layout_;
+  std::vector<std::string> columns_;
+};
+
+}
+
+#endif
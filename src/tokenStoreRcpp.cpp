@@ -0,0 +1,237 @@
+// [[Rcpp::plugins(cpp11)]]
+// [[Rcpp::depends(BH)]]
+
+#define R_NO_REMAP
+
+#include <Rcpp.h>
+#include <string>
+#include <vector>
+#include "tokenStore.h"
+#include "contentHash.h"
+#include "utf8Input.h"
+
+using namespace Rcpp;
+
+typedef XPtr<tokenstore::Reader> TokenStorePtr;
+
+// Decode pool strings on first use, so each distinct string is made once per
+// call. Every code is checked against the pool here, as it is read.
+class PoolCache
+{
+public:
+  explicit PoolCache(const tokenstore::Reader& reader)
+    : reader_(reader), chars_(reader.nStrings()), known_(reader.nStrings(), false)
+  {}
+
+  SEXP get(boost::uint32_t code) {
+    reader_.checkCode(code);
+    if (!known_[code]) {
+      size_t length;
+      const char* data = reader_.string(code, length);
+      // same as posParallel(): "*" marks a missing feature
+      if (length == 1 && data[0] == '*') {
+        SET_STRING_ELT(chars_, code, NA_STRING);
+      } else {
+        SET_STRING_ELT(chars_, code, Rf_mkCharLenCE(data, static_cast<int>(length), CE_UTF8));
+      }
+      known_[code] = true;
+    }
+    return STRING_ELT(chars_, code);
+  }
+
+private:
+  const tokenstore::Reader& reader_;
+  StringVector chars_;
+  std::vector<bool> known_;
+};
+
+//' Open a binary token file by memory mapping.
+//'
+//' @param file String scalar.
+//' @return list of the external pointer, column names and sizes.
+//'
+//' @name tokenStoreOpenRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+List tokenStoreOpenRcpp(std::string file) {
+
+  TokenStorePtr store(new tokenstore::Reader(file), true);
+
+  std::vector<std::string> columns;
+  columns.push_back("doc_id");
+  columns.push_back("sentence_id");
+  columns.push_back("token_id");
+  columns.insert(columns.end(), store->columns().begin(), store->columns().end());
+
+  return List::create(
+    _["pointer"] = store,
+    _["columns"] = wrap(columns),
+    _["n_docs"] = static_cast<double>(store->nDocs()),
+    _["n_tokens"] = static_cast<double>(store->nTokens())
+  );
+}
+
+//' Read one column of a binary token file.
+//'
+//' @param pointer External pointer from `tokenStoreOpenRcpp()`.
+//' @param column String scalar.
+//' @return vector. `doc_id` is an integer vector and `doc_names` a character vector
+//'  (NULL if documents have no names).
+//'
+//' @name tokenStoreColumnRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+SEXP tokenStoreColumnRcpp(SEXP pointer, std::string column) {
+
+  TokenStorePtr store(pointer);
+  const tokenstore::Reader& reader = *store;
+  const R_xlen_t n_tokens = static_cast<R_xlen_t>(reader.nTokens());
+
+  if (column == "doc_id") {
+    IntegerVector result(n_tokens);
+    const boost::uint64_t* offsets = reader.docOffsets();
+    for (size_t k = 0; k < reader.nDocs(); ++k) {
+      std::fill(result.begin() + offsets[k], result.begin() + offsets[k + 1], static_cast<int>(k + 1));
+    }
+    return result;
+  }
+
+  if (column == "sentence_id" || column == "token_id") {
+    const boost::int32_t* values = column == "sentence_id" ? reader.sentenceId() : reader.tokenId();
+    return IntegerVector(values, values + n_tokens);
+  }
+
+  if (column == "doc_names") {
+    if (!reader.hasDocNames()) {
+      return R_NilValue;
+    }
+    PoolCache pool(reader);
+    StringVector result(reader.nDocs());
+    const boost::uint32_t* codes = reader.docNames();
+    for (size_t k = 0; k < reader.nDocs(); ++k) {
+      SET_STRING_ELT(result, k, codes[k] == tokenstore::NO_NAME ? NA_STRING : pool.get(codes[k]));
+    }
+    return result;
+  }
+
+  const std::vector<std::string>& columns = reader.columns();
+  for (size_t c = 0; c < columns.size(); ++c) {
+    if (columns[c] == column) {
+      PoolCache pool(reader);
+      StringVector result(n_tokens);
+      const boost::uint32_t* codes = reader.codes(c);
+      for (R_xlen_t i = 0; i < n_tokens; ++i) {
+        SET_STRING_ELT(result, i, pool.get(codes[i]));
+      }
+      return result;
+    }
+  }
+
+  stop("no column named " + column);
+}
+
+//' Read the rows of some documents of a binary token file.
+//'
+//' @param pointer External pointer from `tokenStoreOpenRcpp()`.
+//' @param docs Integer vector. 1-based documents to read, in output order.
+//' @param doc_id Integer vector. `doc_id` of the rows of each document.
+//' @return list of columns, as `tokenStoreColumnRcpp()` returns them.
+//'
+//' @name tokenStoreDocsRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+List tokenStoreDocsRcpp(SEXP pointer, std::vector<int> docs, std::vector<int> doc_id) {
+
+  TokenStorePtr store(pointer);
+  const tokenstore::Reader& reader = *store;
+  const boost::uint64_t* offsets = reader.docOffsets();
+
+  R_xlen_t n_rows = 0;
+  for (size_t d = 0; d < docs.size(); ++d) {
+    if (docs[d] < 1 || static_cast<size_t>(docs[d]) > reader.nDocs()) {
+      stop("document out of range");
+    }
+    // the reader checks the offsets too; a bad slice must not size the columns
+    const boost::uint64_t begin = offsets[docs[d] - 1];
+    const boost::uint64_t end = offsets[docs[d]];
+    if (begin > end || end > reader.nTokens()) {
+      stop("corrupted document offsets in " + reader.file());
+    }
+    n_rows += static_cast<R_xlen_t>(end - begin);
+  }
+  if (doc_id.size() != docs.size()) {
+    stop("doc_id and docs differ in length");
+  }
+
+  IntegerVector ids(n_rows);
+  IntegerVector sentence_id(n_rows);
+  IntegerVector token_id(n_rows);
+  const std::vector<std::string>& columns = reader.columns();
+  std::vector<StringVector> strings;
+  for (size_t c = 0; c < columns.size(); ++c) {
+    strings.push_back(StringVector(n_rows));
+  }
+
+  // rows of a document are contiguous, so each one is a slice of every column
+  PoolCache pool(reader);
+  R_xlen_t row = 0;
+  for (size_t d = 0; d < docs.size(); ++d) {
+    const boost::uint64_t begin = offsets[docs[d] - 1];
+    const boost::uint64_t end = offsets[docs[d]];
+    for (boost::uint64_t i = begin; i < end; ++i, ++row) {
+      ids[row] = doc_id[d];
+      sentence_id[row] = reader.sentenceId()[i];
+      token_id[row] = reader.tokenId()[i];
+      for (size_t c = 0; c < columns.size(); ++c) {
+        SET_STRING_ELT(strings[c], row, pool.get(reader.codes(c)[i]));
+      }
+    }
+  }
+
+  List result = List::create(
+    _["doc_id"] = ids,
+    _["sentence_id"] = sentence_id,
+    _["token_id"] = token_id
+  );
+  for (size_t c = 0; c < columns.size(); ++c) {
+    result.push_back(strings[c], columns[c]);
+  }
+  return result;
+}
+
+//' Hash texts to tell changed documents apart.
+//'
+//' @param text Character vector.
+//' @return character vector of 16 hexadecimal digits per text, hashed from its UTF-8 bytes.
+//'
+//' @name contentHashRcpp
+//' @keywords internal
+//' @export
+//
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::export]]
+StringVector contentHashRcpp(StringVector text) {
+
+  Utf8Input utf8_input(text);
+  const std::vector<std::string>& input = utf8_input.texts();
+
+  StringVector result(input.size());
+  for (size_t k = 0; k < input.size(); ++k) {
+    boost::uint64_t hash = HASH_BASIS;
+    hashBytes(hash, input[k]);
+    result[k] = hashHex(hash);
+  }
+
+  utf8_input.warn();
+
+  return result;
+}
@@ -0,0 +1,139 @@
+#ifndef RCPPMECAB_UTF8INPUT_H
+#define RCPPMECAB_UTF8INPUT_H
+
+#include <Rcpp.h>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <boost/cstdint.hpp>
+
+// Length of the well-formed UTF-8 sequence at `p`, or 0 if it is invalid
+// (truncated, overlong, a surrogate or above U+10FFFF).
+inline size_t utf8SequenceLength(const unsigned char* p, const unsigned char* end) {
+  const unsigned char c = p[0];
+  if (c < 0x80) {
+    return 1;
+  }
+  size_t n;
+  unsigned char lo = 0x80, hi = 0xBF;
+  if (c >= 0xC2 && c <= 0xDF) {
+    n = 2;
+  } else if (c >= 0xE0 && c <= 0xEF) {
+    n = 3;
+    if (c == 0xE0) lo = 0xA0;
+    if (c == 0xED) hi = 0x9F;
+  } else if (c >= 0xF0 && c <= 0xF4) {
+    n = 4;
+    if (c == 0xF0) lo = 0x90;
+    if (c == 0xF4) hi = 0x8F;
+  } else {
+    return 0;
+  }
+  if (static_cast<size_t>(end - p) < n || p[1] < lo || p[1] > hi) {
+    return 0;
+  }
+  for (size_t i = 2; i < n; ++i) {
+    if (p[i] < 0x80 || p[i] > 0xBF) {
+      return 0;
+    }
+  }
+  return n;
+}
+
+// Scan eight bytes at a time while they are ASCII, which is most of the
+// input, and decode sequences only around non-ASCII bytes.
+inline bool isValidUtf8(const char* data, size_t size) {
+  const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+  const unsigned char* end = p + size;
+  while (p < end) {
+    if (end - p >= 8) {
+      boost::uint64_t word;
+      std::memcpy(&word, p, sizeof(word));
+      if ((word & 0x8080808080808080ULL) == 0) {
+        p += 8;
+        continue;
+      }
+    }
+    const size_t n = utf8SequenceLength(p, end);
+    if (n == 0) {
+      return false;
+    }
+    p += n;
+  }
+  return true;
+}
+
+// Copy of `data` with every invalid byte replaced by U+FFFD.
+inline std::string repairUtf8(const char* data, size_t size) {
+  const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+  const unsigned char* end = p + size;
+  std::string repaired;
+  repaired.reserve(size + 8);
+  while (p < end) {
+    const size_t n = utf8SequenceLength(p, end);
+    if (n == 0) {
+      repaired.append("\xEF\xBF\xBD");
+      p++;
+    } else {
+      repaired.append(reinterpret_cast<const char*>(p), n);
+      p += n;
+    }
+  }
+  return repaired;
+}
+
+// Text elements as UTF-8 for MeCab. Elements marked as UTF-8 or ASCII are
+// used as they are, so the usual all-UTF-8 input needs no conversion; others
+// are translated from their declared encoding. Invalid sequences are
+// replaced and the documents are recorded, to be reported by `warn()`.
+class Utf8Input
+{
+public:
+  explicit Utf8Input(SEXP text) {
+    const R_xlen_t n = Rf_xlength(text);
+    for (R_xlen_t i = 0; i < n; ++i) {
+      SEXP elem = STRING_ELT(text, i);
+      // translated strings live in R_alloc memory until the copy below
+      const void* vmax = vmaxget();
+      const char* data;
+      if (IS_UTF8(elem) || IS_ASCII(elem) || Rf_getCharCE(elem) == CE_BYTES) {
+        data = CHAR(elem);
+      } else {
+        data = Rf_translateCharUTF8(elem);
+      }
+      const size_t size = std::strlen(data);
+      if (isValidUtf8(data, size)) {
+        texts_.push_back(std::string(data, size));
+      } else {
+        texts_.push_back(repairUtf8(data, size));
+        invalid_.push_back(static_cast<int>(i + 1));
+      }
+      vmaxset(vmax);
+    }
+  }
+
+  std::vector<std::string>& texts() { return texts_; }
+  const std::vector<int>& invalid() const { return invalid_; }
+
+  void warn() const {
+    if (invalid_.empty()) {
+      return;
+    }
+    std::ostringstream message;
+    message << invalid_.size() << " document(s) had invalid UTF-8, replaced by U+FFFD: ";
+    for (size_t k = 0; k < invalid_.size() && k < 10; ++k) {
+      message << (k ? ", " : "") << invalid_[k];
+    }
+    if (invalid_.size() > 10) {
+      message << ", ...";
+    }
+    Rcpp::warning(message.str());
+  }
+
+private:
+  std::vector<std::string> texts_;
+  std::vector<int> invalid_;
+};
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef RCPPMECAB_VOCABULARY_H
+#define RCPPMECAB_VOCABULARY_H
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <boost/cstdint.hpp>
+
+// Vocabulary shared by the parse workers. Strings are spread over shards by
+// hash, each behind its own mutex, so workers rarely wait for each other.
+// A code packs the shard and the index in the shard; `Renumbering` turns
+// codes into ids in order of first appearance afterwards, so ids do not
+// depend on how the documents were scheduled.
+class ShardedVocabulary
+{
+public:
+  static const size_t SHARDS = 64;
+
+  boost::uint32_t code(const std::string& value) {
+    const size_t shard = std::hash<std::string>()(value) % SHARDS;
+    Shard& s = shards_[shard];
+    std::lock_guard<std::mutex> lock(s.mutex);
+    std::unordered_map<std::string, boost::uint32_t>::iterator it = s.index.find(value);
+    if (it == s.index.end()) {
+      it = s.index.insert(std::make_pair(value, static_cast<boost::uint32_t>(s.types.size()))).first;
+      s.types.push_back(value);
+    }
+    return static_cast<boost::uint32_t>(it->second * SHARDS + shard);
+  }
+
+  // Not safe while workers add strings.
+  const std::string& type(boost::uint32_t code) const {
+    return shards_[code % SHARDS].types[code / SHARDS];
+  }
+
+  size_t codeLimit() const {
+    size_t largest = 0;
+    for (size_t s = 0; s < SHARDS; ++s) {
+      largest = std::max(largest, shards_[s].types.size());
+    }
+    return largest * SHARDS;
+  }
+
+private:
+  struct Shard
+  {
+    std::mutex mutex;
+    std::unordered_map<std::string, boost::uint32_t> index;
+    std::vector<std::string> types;
+  };
+
+  Shard shards_[SHARDS];
+};
+
+// Dense 1-based ids for the codes of a vocabulary, in the order they are seen.
+class Renumbering
+{
+public:
+  explicit Renumbering(const ShardedVocabulary& vocabulary)
+    : vocabulary_(vocabulary), ids_(vocabulary.codeLimit(), 0)
+  {}
+
+  int id(boost::uint32_t code) {
+    if (ids_[code] == 0) {
+      types_.push_back(code);
+      ids_[code] = static_cast<int>(types_.size());
+    }
+    return ids_[code];
+  }
+
+  size_t size() const { return types_.size(); }
+  const std::string& type(size_t id) const { return vocabulary_.type(types_[id - 1]); }
+
+private:
+  const ShardedVocabulary& vocabulary_;
+  std::vector<int> ids_;
+  std::vector<boost::uint32_t> types_;
+};
+
+#endif